@@ -17,10 +17,16 @@ import subprocess
 
 hostArg = ''
 rightScreen = False
+dedicatedServer = False
+saveSlot = '1'
 if len(sys.argv) >= 2:
 	if sys.argv[1] == 'host':
 		hostArg = '-host'
 		rightScreen = True
+	elif sys.argv[1] == 'server':
+		dedicatedServer = True
+		if len(sys.argv) >= 3:
+			saveSlot = sys.argv[2]
 
 
 #-------------------------------------------------------------------------------
@@ -59,14 +65,26 @@ engineExecutable = os.path.join(engineDir, 'Engine', 'Binaries', 'Win64', 'Unrea
 # Launch
 #-------------------------------------------------------------------------------
 
-subprocess.Popen([
-	engineExecutable,
-	projectFile,
-	'-skipcompile',
-	'-game',
-	'-ResX=2560',
-	'-ResY=1440',
-	'-WinX=2560' if rightScreen else '-WinX=0',
-	'-WinY=30',
-	hostArg
-])
+if dedicatedServer:
+	subprocess.Popen([
+		engineExecutable,
+		projectFile,
+		'-skipcompile',
+		'-server',
+		'-SaveSlot=' + saveSlot,
+		'-log',
+		'-nosound',
+		'-nullrhi'
+	])
+else:
+	subprocess.Popen([
+		engineExecutable,
+		projectFile,
+		'-skipcompile',
+		'-game',
+		'-ResX=2560',
+		'-ResY=1440',
+		'-WinX=2560' if rightScreen else '-WinX=0',
+		'-WinY=30',
+		hostArg
+	])
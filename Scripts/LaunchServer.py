@@ -2,5 +2,9 @@
 # -*- coding: utf-8 -*-
 
 import os
+import sys
 
-os.system('Launch.py host')
+# Optional save slot to host, defaults to the first one
+saveSlot = sys.argv[1] if len(sys.argv) >= 2 else '1'
+
+os.system('Launch.py server ' + saveSlot)
@@ -32,6 +32,13 @@ public:
 	{
 		Super::BeginPlay();
 
+		// Materialization is purely visual on dedicated servers
+		if (IsRunningDedicatedServer())
+		{
+			SetComponentTickEnabled(false);
+			return;
+		}
+
 		FNovaMeshInterfaceBehavior::SetupMaterial(this, GetMaterial(0));
 	}
 
@@ -24,12 +24,22 @@ FNovaMeshInterfaceBehavior::FNovaMeshInterfaceBehavior()
 
 void FNovaMeshInterfaceBehavior::SetupMaterial(UPrimitiveComponent* Mesh, UMaterialInterface* Material)
 {
+	if (IsRunningDedicatedServer())
+	{
+		return;
+	}
+
 	ComponentMaterial = UMaterialInstanceDynamic::Create(Material, Mesh);
 	Mesh->SetMaterial(0, ComponentMaterial);
 }
 
 void FNovaMeshInterfaceBehavior::SetupMaterial(UDecalComponent* Decal, UMaterialInterface* Material)
 {
+	if (IsRunningDedicatedServer())
+	{
+		return;
+	}
+
 	ComponentMaterial = UMaterialInstanceDynamic::Create(Material, Decal);
 }
 
@@ -86,7 +96,8 @@ void FNovaMeshInterfaceBehavior::Materialize(bool Force)
 {
 	CurrentMaterializationState = true;
 
-	if (Force)
+	// Dedicated servers don't render, skip the transition
+	if (Force || IsRunningDedicatedServer())
 	{
 		CurrentMaterializationTime = MaterializationDuration;
 	}
@@ -96,7 +107,8 @@ void FNovaMeshInterfaceBehavior::Dematerialize(bool Force)
 {
 	CurrentMaterializationState = false;
 
-	if (Force)
+	// Dedicated servers don't render, skip the transition
+	if (Force || IsRunningDedicatedServer())
 	{
 		CurrentMaterializationTime = 0;
 	}
@@ -109,7 +121,11 @@ float FNovaMeshInterfaceBehavior::GetMaterializationAlpha() const
 
 void FNovaMeshInterfaceBehavior::RequestParameter(FName Name, float Value, bool Immediate)
 {
-	if (Immediate)
+	if (ComponentMaterial == nullptr)
+	{
+		return;
+	}
+	else if (Immediate)
 	{
 		ComponentMaterial->SetScalarParameterValue(Name, Value);
 
@@ -141,7 +157,11 @@ void FNovaMeshInterfaceBehavior::RequestParameter(FName Name, float Value, bool
 
 void FNovaMeshInterfaceBehavior::RequestParameter(FName Name, FLinearColor Value, bool Immediate)
 {
-	if (Immediate)
+	if (ComponentMaterial == nullptr)
+	{
+		return;
+	}
+	else if (Immediate)
 	{
 		ComponentMaterial->SetVectorParameterValue(Name, Value);
 
@@ -33,6 +33,13 @@ public:
 	{
 		Super::BeginPlay();
 
+		// Materialization is purely visual on dedicated servers
+		if (IsRunningDedicatedServer())
+		{
+			SetComponentTickEnabled(false);
+			return;
+		}
+
 		UMaterialInterface* CurrentMaterial = GetMaterial(0);
 		if (CurrentMaterial == nullptr || !CurrentMaterial->IsA<UMaterialInstanceDynamic>())
 		{
@@ -4,6 +4,7 @@
 #include "NovaPlayerStart.h"
 
 #include "Actor/NovaActorTools.h"
+#include "Game/NovaGameState.h"
 
 #include "Spacecraft/NovaSpacecraftCompartmentComponent.h"
 #include "Spacecraft/NovaSpacecraftHatchComponent.h"
@@ -40,6 +41,12 @@ void UNovaStationRingComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// Rings only animate towards docked spacecraft, which dedicated servers never display
+	if (IsRunningDedicatedServer())
+	{
+		SetComponentTickEnabled(false);
+	}
+
 	// Find our where the socket is
 	FTransform SocketTransform = GetSocketTransform("Base", RTS_Component);
 	SocketRelativeLocation     = SocketTransform.GetTranslation();
@@ -87,17 +94,18 @@ void UNovaStationRingComponent::TickComponent(float DeltaTime, ELevelTick TickTy
 	// Find a spacecraft to work with
 	if (IsValid(AttachedPlayerStart) && !IsValid(AttachedSpacecraft))
 	{
-		TArray<AActor*> SpacecraftPawns;
-		UGameplayStatics::GetAllActorsOfClass(this, ANovaSpacecraftPawn::StaticClass(), SpacecraftPawns);
-
-		for (const AActor* SpacecraftPawn : SpacecraftPawns)
+		const ANovaGameState* GameState = GetWorld()->GetGameState<ANovaGameState>();
+		if (IsValid(GameState))
 		{
-			const UNovaSpacecraftMovementComponent* MovementComponent = Cast<ANovaSpacecraftPawn>(SpacecraftPawn)->GetSpacecraftMovement();
-			NCHECK(MovementComponent);
-
-			if (AttachedPlayerStart == MovementComponent->GetPlayerStart())
+			for (ANovaSpacecraftPawn* SpacecraftPawn : GameState->GetSpacecraftPawns())
 			{
-				AttachedSpacecraft = Cast<ANovaSpacecraftPawn>(SpacecraftPawn);
+				const UNovaSpacecraftMovementComponent* MovementComponent = SpacecraftPawn->GetSpacecraftMovement();
+				NCHECK(MovementComponent);
+
+				if (AttachedPlayerStart == MovementComponent->GetPlayerStart())
+				{
+					AttachedSpacecraft = SpacecraftPawn;
+				}
 			}
 		}
 	}
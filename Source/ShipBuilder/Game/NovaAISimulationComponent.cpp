@@ -15,27 +15,52 @@
 
 #include "Nova.h"
 
+#include "Async/Async.h"
 #include "Dom/JsonObject.h"
 #include "JsonObjectConverter.h"
 
 #define LOCTEXT_NAMESPACE "UNovaAISimulationComponent"
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("AI spacecraft processed"), STAT_NovaAIProcessedSpacecraft, STATGROUP_Nova);
+DECLARE_DWORD_COUNTER_STAT(TEXT("AI spacecraft tier changes"), STAT_NovaAITierChanges, STATGROUP_Nova);
+DECLARE_CYCLE_STAT(TEXT("AI simulation"), STAT_NovaAISimulation, STATGROUP_Nova);
+DECLARE_CYCLE_STAT(TEXT("AI tier updates"), STAT_NovaAITiers, STATGROUP_Nova);
+DECLARE_CYCLE_STAT(TEXT("AI navigation"), STAT_NovaAINavigation, STATGROUP_Nova);
+
 /*----------------------------------------------------
     Definitions
 ----------------------------------------------------*/
 
-// Procedural generation
-static constexpr int32 InitialTechnicalSpacecraftCount = 42;
-
 // Spawning
 static constexpr int32 SpacecraftSpawnDistanceKm   = 100;
 static constexpr int32 SpacecraftDespawnDistanceKm = 200;
+static constexpr int32 SpacecraftSpawnsPerFrame    = 1;
+static constexpr int32 MaxPooledSpacecraftPerClass = 4;
+static constexpr int32 MinParallelTierUpdates      = 64;
+
+// Navigation
+static constexpr double SpacecraftStateMinimumDurationMinutes = 5;
+static constexpr double SpacecraftRetryDelayMinutes           = 1;
+static constexpr int32  MaxTrajectoryJobsInFlight             = 4;
+static constexpr int32  TrajectoryJobCommitTicks              = 2;
+static constexpr int32  MaxTrajectoryJobAttempts              = 3;
+
+// Fleets
+static constexpr double FleetDepartureWindowMinutes = 2;
+static constexpr double FleetMergeDistanceKm        = 1;
+static constexpr int32  MaxFleetSize                = 8;
+
+// Area selection
+static constexpr double AreaStationWeight     = 2.0;
+static constexpr double AreaTradeWeight       = 0.25;
+static constexpr float  AreaAltitudeBandKm    = 500;
+static constexpr int32  AreaSelectionAttempts = 8;
 
 /*----------------------------------------------------
     Constructor
 ----------------------------------------------------*/
 
-UNovaAISimulationComponent::UNovaAISimulationComponent() : Super()
+UNovaAISimulationComponent::UNovaAISimulationComponent() : Super(), CurrentTick(0)
 {
 	// Technical ship names
 	TechnicalNamePrefixes = {TEXT("Analog"), TEXT("Broken"), TEXT("Clockwork"), TEXT("Drab"), TEXT("Electric"), TEXT("Flying"),
@@ -48,6 +73,14 @@ UNovaAISimulationComponent::UNovaAISimulationComponent() : Super()
 
 	// Settings
 	PrimaryComponentTick.bCanEverTick = true;
+	AreaTablesRevision                = -1;
+
+	// Defaults
+	SpacecraftCount                = 42;
+	SpacecraftPromotionDistance    = 500;
+	SpacecraftDemotionDistance     = 1000;
+	SpacecraftTierUpdatesPerFrame  = 250;
+	AbstractSpacecraftWakeupPeriod = 15;
 }
 
 /*----------------------------------------------------
@@ -56,6 +89,9 @@ UNovaAISimulationComponent::UNovaAISimulationComponent() : Super()
 
 struct FNovaAISpacecraftStateSave
 {
+	FNovaAISpacecraftStateSave() : Revision(0)
+	{}
+
 	FGuid                               SpacecraftIdentifier;
 	const UNovaAISpacecraftDescription* SpacecraftClass;
 	FString                             SpacecraftName;
@@ -66,11 +102,15 @@ struct FNovaAISpacecraftStateSave
 
 	FNovaOrbit      Orbit;
 	FNovaTrajectory Trajectory;
+
+	// Runtime revision, only used to detect changes between saves and never written
+	uint32 Revision;
 };
 
+// Spacecraft entries are immutable once built, and shared between snapshots until the spacecraft changes
 struct FNovaAIStateSave
 {
-	TArray<FNovaAISpacecraftStateSave> SpacecraftStates;
+	TArray<TSharedPtr<const FNovaAISpacecraftStateSave>> SpacecraftStates;
 };
 
 TSharedPtr<FNovaAIStateSave> UNovaAISimulationComponent::Save() const
@@ -78,53 +118,63 @@ TSharedPtr<FNovaAIStateSave> UNovaAISimulationComponent::Save() const
 	NCHECK(GetOwner()->GetLocalRole() == ROLE_Authority);
 
 	TSharedPtr<FNovaAIStateSave> SaveData = MakeShared<FNovaAIStateSave>();
+	SaveData->SpacecraftStates.Reserve(SpacecraftDatabase.Num());
 
-	// Get game state pointers
-	ANovaGameState* GameState = Cast<ANovaGameState>(GetOwner());
-	NCHECK(GameState);
-	UNovaOrbitalSimulationComponent* OrbitalSimulation = GameState->GetOrbitalSimulation();
-	NCHECK(OrbitalSimulation);
-
-	// Iterate over the AI database
+	// Iterate over the AI database, only building new entries for spacecraft modified since the previous save
+	TMap<FGuid, TSharedPtr<const FNovaAISpacecraftStateSave>> NewSpacecraftSaveCache;
+	NewSpacecraftSaveCache.Reserve(SpacecraftDatabase.Num());
 	for (const TPair<FGuid, FNovaAISpacecraftState>& IdentifierAndSpacecraft : SpacecraftDatabase)
 	{
-		FNovaAISpacecraftStateSave SpacecraftSaveData;
-
 		FGuid                         Identifier      = IdentifierAndSpacecraft.Key;
 		const FNovaAISpacecraftState& SpacecraftState = IdentifierAndSpacecraft.Value;
-		const FNovaOrbit*             Orbit           = OrbitalSimulation->GetSpacecraftOrbit(Identifier);
-		const FNovaTrajectory*        Trajectory      = OrbitalSimulation->GetSpacecraftTrajectory(Identifier);
 
-		// Spacecraft
-		const FNovaSpacecraft* Spacecraft = GameState->GetSpacecraft(Identifier);
-		NCHECK(Spacecraft);
-		SpacecraftSaveData.SpacecraftIdentifier = Identifier;
-		SpacecraftSaveData.SpacecraftClass      = Spacecraft->SpacecraftClass;
-		SpacecraftSaveData.SpacecraftName       = Spacecraft->Name;
+		const TSharedPtr<const FNovaAISpacecraftStateSave>* CachedSaveData = SpacecraftSaveCache.Find(Identifier);
+		if (CachedSaveData && (*CachedSaveData)->Revision == SpacecraftState.Revision)
+		{
+			SaveData->SpacecraftStates.Add(*CachedSaveData);
+			NewSpacecraftSaveCache.Add(Identifier, *CachedSaveData);
+			continue;
+		}
 
-		// State
-		SpacecraftSaveData.TargetArea            = SpacecraftState.TargetArea;
-		SpacecraftSaveData.CurrentState          = SpacecraftState.CurrentState;
-		SpacecraftSaveData.CurrentStateStartTime = SpacecraftState.CurrentStateStartTime;
+		TSharedPtr<FNovaAISpacecraftStateSave> SpacecraftSaveData = MakeShared<FNovaAISpacecraftStateSave>();
+		const FNovaOrbit*                      Orbit              = GetSpacecraftOrbit(Identifier, SpacecraftState);
+		const FNovaTrajectory*                 Trajectory         = GetSpacecraftTrajectory(Identifier, SpacecraftState);
+
+		// Spacecraft
+		SpacecraftSaveData->SpacecraftIdentifier = Identifier;
+		SpacecraftSaveData->SpacecraftClass      = SpacecraftState.SpacecraftClass;
+		SpacecraftSaveData->SpacecraftName       = SpacecraftState.SpacecraftName;
+
+		// State, with trajectory planning restarting from scratch after loading
+		SpacecraftSaveData->TargetArea   = SpacecraftState.TargetArea;
+		SpacecraftSaveData->CurrentState = SpacecraftState.CurrentState == ENovaAISpacecraftState::Planning
+											 ? ENovaAISpacecraftState::Idle
+											 : SpacecraftState.CurrentState;
+		SpacecraftSaveData->CurrentStateStartTime = SpacecraftState.CurrentStateStartTime;
+		SpacecraftSaveData->Revision              = SpacecraftState.Revision;
 
 		// Trajectory & orbit
 		if (Trajectory)
 		{
-			SpacecraftSaveData.Trajectory = *Trajectory;
+			SpacecraftSaveData->Trajectory = *Trajectory;
 		}
 		else if (Orbit)
 		{
-			SpacecraftSaveData.Orbit = *Orbit;
+			SpacecraftSaveData->Orbit = *Orbit;
 		}
 
 		// Sanity checks
-		NCHECK(SpacecraftSaveData.SpacecraftIdentifier.IsValid());
-		NCHECK(SpacecraftSaveData.SpacecraftClass != nullptr);
-		NCHECK(SpacecraftSaveData.SpacecraftName.Len() > 0);
+		NCHECK(SpacecraftSaveData->SpacecraftIdentifier.IsValid());
+		NCHECK(SpacecraftSaveData->SpacecraftClass != nullptr);
+		NCHECK(SpacecraftSaveData->SpacecraftName.Len() > 0);
 
 		SaveData->SpacecraftStates.Add(SpacecraftSaveData);
+		NewSpacecraftSaveCache.Add(Identifier, SpacecraftSaveData);
 	}
 
+	// Drop removed spacecraft from the cache
+	SpacecraftSaveCache = MoveTemp(NewSpacecraftSaveCache);
+
 	return SaveData;
 }
 
@@ -137,18 +187,17 @@ void UNovaAISimulationComponent::Load(TSharedPtr<FNovaAIStateSave> SaveData)
 	// Ensure consistency
 	NCHECK(SaveData != nullptr);
 
-	// Get game state pointers
-	ANovaGameState* GameState = Cast<ANovaGameState>(GetOwner());
-	NCHECK(GameState);
-	UNovaOrbitalSimulationComponent* OrbitalSimulation = GameState->GetOrbitalSimulation();
-	NCHECK(OrbitalSimulation);
+	// Loaded entries are kept as they are until the spacecraft change
+	SpacecraftSaveCache.Empty();
 
 	// Load actual data
 	if (SaveData->SpacecraftStates.Num() > 0)
 	{
 		// Iterate over the save data
-		for (const FNovaAISpacecraftStateSave& SpacecraftSaveData : SaveData->SpacecraftStates)
+		for (const TSharedPtr<const FNovaAISpacecraftStateSave>& SpacecraftSaveDataPtr : SaveData->SpacecraftStates)
 		{
+			const FNovaAISpacecraftStateSave& SpacecraftSaveData = *SpacecraftSaveDataPtr;
+
 			FNovaAISpacecraftState SpacecraftState;
 
 			// Sanity checks
@@ -157,24 +206,26 @@ void UNovaAISimulationComponent::Load(TSharedPtr<FNovaAIStateSave> SaveData)
 			NCHECK(SpacecraftSaveData.SpacecraftName.Len() > 0);
 
 			// Spacecraft
-			FNovaSpacecraft Spacecraft = SpacecraftSaveData.SpacecraftClass->Spacecraft;
-			Spacecraft.Name            = SpacecraftSaveData.SpacecraftName;
-			Spacecraft.SpacecraftClass = SpacecraftSaveData.SpacecraftClass;
-			Spacecraft.Identifier      = SpacecraftSaveData.SpacecraftIdentifier;
+			SpacecraftState.SpacecraftClass = SpacecraftSaveData.SpacecraftClass;
+			SpacecraftState.SpacecraftName  = SpacecraftSaveData.SpacecraftName;
 
 			// Common
 			SpacecraftState.TargetArea            = SpacecraftSaveData.TargetArea;
 			SpacecraftState.CurrentState          = SpacecraftSaveData.CurrentState;
 			SpacecraftState.CurrentStateStartTime = SpacecraftSaveData.CurrentStateStartTime;
+			SpacecraftState.Revision              = SpacecraftSaveData.Revision;
+
+			// Trajectory & orbit, with all spacecraft starting in the abstract tier
+			SpacecraftState.Orbit      = SpacecraftSaveData.Orbit;
+			SpacecraftState.Trajectory = SpacecraftSaveData.Trajectory;
 
 			// Register the spacecraft
-			SpacecraftDatabase.Add(Spacecraft.Identifier, SpacecraftState);
-			GameState->UpdateSpacecraft(Spacecraft, &SpacecraftSaveData.Orbit);
-			if (SpacecraftSaveData.Trajectory.IsValid())
-			{
-				OrbitalSimulation->CommitTrajectory({Spacecraft.Identifier}, SpacecraftSaveData.Trajectory);
-			}
+			FNovaAISpacecraftState& RegisteredState = SpacecraftDatabase.Add(SpacecraftSaveData.SpacecraftIdentifier, SpacecraftState);
+			SpacecraftSaveCache.Add(SpacecraftSaveData.SpacecraftIdentifier, SpacecraftSaveDataPtr);
+			ScheduleWakeup(SpacecraftSaveData.SpacecraftIdentifier, RegisteredState, true);
 		}
+
+		ProcessQuotas();
 	}
 
 	// New game
@@ -193,9 +244,10 @@ void UNovaAISimulationComponent::SerializeJson(
 		JsonData = MakeShared<FJsonObject>();
 		TArray<TSharedPtr<FJsonValue>> SpacecraftJsonDataArray;
 
-		for (const FNovaAISpacecraftStateSave& SpacecraftSaveData : SaveData->SpacecraftStates)
+		for (const TSharedPtr<const FNovaAISpacecraftStateSave>& SpacecraftSaveDataPtr : SaveData->SpacecraftStates)
 		{
-			TSharedPtr<FJsonObject> SpacecraftJsonData = MakeShared<FJsonObject>();
+			const FNovaAISpacecraftStateSave& SpacecraftSaveData = *SpacecraftSaveDataPtr;
+			TSharedPtr<FJsonObject>           SpacecraftJsonData = MakeShared<FJsonObject>();
 
 			// Spacecraft
 			SpacecraftJsonData->SetStringField("SI", SpacecraftSaveData.SpacecraftIdentifier.ToString());
@@ -230,7 +282,8 @@ void UNovaAISimulationComponent::SerializeJson(
 			{
 				TSharedPtr<FJsonObject> SpacecraftJsonData = SpacecraftJsonValue->AsObject();
 
-				FNovaAISpacecraftStateSave SpacecraftSaveData;
+				TSharedPtr<FNovaAISpacecraftStateSave> SpacecraftSaveDataPtr = MakeShared<FNovaAISpacecraftStateSave>();
+				FNovaAISpacecraftStateSave&            SpacecraftSaveData    = *SpacecraftSaveDataPtr;
 
 				// Spacecraft
 				NCHECK(FGuid::Parse(SpacecraftJsonData->GetStringField("SI"), SpacecraftSaveData.SpacecraftIdentifier));
@@ -250,10 +303,173 @@ void UNovaAISimulationComponent::SerializeJson(
 				FJsonObjectConverter::JsonObjectToUStruct<FNovaTrajectory>(
 					SpacecraftJsonData->GetObjectField("T").ToSharedRef(), &SpacecraftSaveData.Trajectory);
 
-				SaveData->SpacecraftStates.Add(SpacecraftSaveData);
+				SaveData->SpacecraftStates.Add(SpacecraftSaveDataPtr);
+			}
+		}
+	}
+}
+
+/** Write a single spacecraft, or read it into a new entry */
+static void SerializeSpacecraftBinary(TSharedPtr<const FNovaAISpacecraftStateSave>& SpacecraftSaveDataPtr, FArchive& Ar)
+{
+	// Shared entries are never modified, since they are only written to when loading
+	TSharedPtr<FNovaAISpacecraftStateSave> NewSaveData =
+		Ar.IsLoading() ? MakeShared<FNovaAISpacecraftStateSave>() : ConstCastSharedPtr<FNovaAISpacecraftStateSave>(SpacecraftSaveDataPtr);
+	FNovaAISpacecraftStateSave& SpacecraftSaveData = *NewSaveData;
+	if (Ar.IsLoading())
+	{
+		SpacecraftSaveDataPtr = NewSaveData;
+	}
+
+	// Spacecraft
+	Ar << SpacecraftSaveData.SpacecraftIdentifier;
+	UNovaAssetDescription::SerializeAsset(Ar, SpacecraftSaveData.SpacecraftClass);
+	Ar << SpacecraftSaveData.SpacecraftName;
+
+	// Common
+	uint8 CurrentState = static_cast<uint8>(SpacecraftSaveData.CurrentState);
+	UNovaAssetDescription::SerializeAsset(Ar, SpacecraftSaveData.TargetArea);
+	Ar << CurrentState;
+	Ar << SpacecraftSaveData.CurrentStateStartTime;
+	SpacecraftSaveData.CurrentState = static_cast<ENovaAISpacecraftState>(CurrentState);
+
+	// Trajectory & orbit
+	Ar << SpacecraftSaveData.Orbit;
+	Ar << SpacecraftSaveData.Trajectory;
+}
+
+void UNovaAISimulationComponent::SerializeBinary(TSharedPtr<FNovaAIStateSave>& SaveData, FArchive& Ar)
+{
+	if (Ar.IsLoading())
+	{
+		SaveData = MakeShared<FNovaAIStateSave>();
+	}
+
+	int32 SpacecraftCount = SaveData->SpacecraftStates.Num();
+	Ar << SpacecraftCount;
+	if (Ar.IsLoading())
+	{
+		if (!IsSerializedCountValid(Ar, SpacecraftCount))
+		{
+			return;
+		}
+		SaveData->SpacecraftStates.SetNum(SpacecraftCount);
+	}
+
+	for (TSharedPtr<const FNovaAISpacecraftStateSave>& SpacecraftSaveData : SaveData->SpacecraftStates)
+	{
+		SerializeSpacecraftBinary(SpacecraftSaveData, Ar);
+	}
+}
+
+int32 UNovaAISimulationComponent::SerializeBinaryDelta(
+	TSharedPtr<FNovaAIStateSave>& SaveData, const TMap<FGuid, uint32>& Revisions, FArchive& Ar)
+{
+	NCHECK(SaveData.IsValid());
+
+	TArray<FGuid> RemovedIdentifiers;
+	int32         ModifiedCount = 0;
+
+	// Writing to save : only compare revisions, and serialize the spacecraft that changed
+	if (Ar.IsSaving())
+	{
+		TSet<FGuid> Identifiers;
+		Identifiers.Reserve(SaveData->SpacecraftStates.Num());
+		for (const TSharedPtr<const FNovaAISpacecraftStateSave>& SpacecraftSaveData : SaveData->SpacecraftStates)
+		{
+			const uint32* Revision = Revisions.Find(SpacecraftSaveData->SpacecraftIdentifier);
+			if (Revision == nullptr || *Revision != SpacecraftSaveData->Revision)
+			{
+				ModifiedCount++;
+			}
+			Identifiers.Add(SpacecraftSaveData->SpacecraftIdentifier);
+		}
+
+		for (const TPair<FGuid, uint32>& IdentifierAndRevision : Revisions)
+		{
+			if (!Identifiers.Contains(IdentifierAndRevision.Key))
+			{
+				RemovedIdentifiers.Add(IdentifierAndRevision.Key);
+			}
+		}
+
+		Ar << RemovedIdentifiers;
+		Ar << ModifiedCount;
+		for (TSharedPtr<const FNovaAISpacecraftStateSave>& SpacecraftSaveData : SaveData->SpacecraftStates)
+		{
+			const uint32* Revision = Revisions.Find(SpacecraftSaveData->SpacecraftIdentifier);
+			if (Revision == nullptr || *Revision != SpacecraftSaveData->Revision)
+			{
+				SerializeSpacecraftBinary(SpacecraftSaveData, Ar);
+			}
+		}
+	}
+
+	// Reading from save : remove spacecraft, then replace or add the modified ones
+	else
+	{
+		int32 RemovedCount = 0;
+		Ar << RemovedCount;
+		if (!IsSerializedCountValid(Ar, RemovedCount, sizeof(FGuid)))
+		{
+			return 0;
+		}
+		RemovedIdentifiers.SetNum(RemovedCount);
+		for (FGuid& Identifier : RemovedIdentifiers)
+		{
+			Ar << Identifier;
+		}
+
+		Ar << ModifiedCount;
+		if (!IsSerializedCountValid(Ar, ModifiedCount))
+		{
+			return 0;
+		}
+
+		TArray<TSharedPtr<const FNovaAISpacecraftStateSave>>& SpacecraftStates = SaveData->SpacecraftStates;
+		TSet<FGuid>                                           RemovedSet(RemovedIdentifiers);
+		SpacecraftStates.RemoveAll(
+			[&](const TSharedPtr<const FNovaAISpacecraftStateSave>& SpacecraftSaveData)
+			{
+				return RemovedSet.Contains(SpacecraftSaveData->SpacecraftIdentifier);
+			});
+
+		TMap<FGuid, int32> SpacecraftIndices;
+		for (int32 Index = 0; Index < SpacecraftStates.Num(); Index++)
+		{
+			SpacecraftIndices.Add(SpacecraftStates[Index]->SpacecraftIdentifier, Index);
+		}
+
+		for (int32 Index = 0; Index < ModifiedCount && !Ar.IsError(); Index++)
+		{
+			TSharedPtr<const FNovaAISpacecraftStateSave> SpacecraftSaveData;
+			SerializeSpacecraftBinary(SpacecraftSaveData, Ar);
+
+			const int32* ExistingIndex = SpacecraftIndices.Find(SpacecraftSaveData->SpacecraftIdentifier);
+			if (ExistingIndex)
+			{
+				SpacecraftStates[*ExistingIndex] = SpacecraftSaveData;
+			}
+			else
+			{
+				SpacecraftIndices.Add(SpacecraftSaveData->SpacecraftIdentifier, SpacecraftStates.Add(SpacecraftSaveData));
 			}
 		}
 	}
+
+	return RemovedIdentifiers.Num() + ModifiedCount;
+}
+
+void UNovaAISimulationComponent::GetRevisions(const TSharedPtr<FNovaAIStateSave>& SaveData, TMap<FGuid, uint32>& Revisions)
+{
+	NCHECK(SaveData.IsValid());
+
+	Revisions.Reset();
+	Revisions.Reserve(SaveData->SpacecraftStates.Num());
+	for (const TSharedPtr<const FNovaAISpacecraftStateSave>& SpacecraftSaveData : SaveData->SpacecraftStates)
+	{
+		Revisions.Add(SpacecraftSaveData->SpacecraftIdentifier, SpacecraftSaveData->Revision);
+	}
 }
 
 /*----------------------------------------------------
@@ -263,6 +479,7 @@ void UNovaAISimulationComponent::SerializeJson(
 void UNovaAISimulationComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	SCOPE_CYCLE_COUNTER(STAT_NovaAISimulation);
 
 	// Run local processes
 	ProcessSpawning();
@@ -270,8 +487,18 @@ void UNovaAISimulationComponent::TickComponent(float DeltaTime, ELevelTick TickT
 	// Run server processes
 	if (GetOwner()->GetLocalRole() == ROLE_Authority)
 	{
-		ProcessQuotas();
-		ProcessNavigation();
+		{
+			SCOPE_CYCLE_COUNTER(STAT_NovaAITiers);
+			ProcessTiers();
+		}
+
+		ProcessDepartures();
+		ProcessTrajectoryJobs();
+
+		{
+			SCOPE_CYCLE_COUNTER(STAT_NovaAINavigation);
+			ProcessNavigation();
+		}
 	}
 }
 
@@ -303,56 +530,91 @@ void UNovaAISimulationComponent::ProcessQuotas()
 	}
 }
 
-void UNovaAISimulationComponent::ProcessSpawning()
+void UNovaAISimulationComponent::ProcessTiers()
 {
 	// Get game state pointers
 	ANovaGameState* GameState = Cast<ANovaGameState>(GetOwner());
 	NCHECK(GameState);
 	UNovaOrbitalSimulationComponent* OrbitalSimulation = GameState->GetOrbitalSimulation();
 	NCHECK(OrbitalSimulation);
-	const FNovaOrbitalLocation* PlayerLocation = OrbitalSimulation->GetPlayerLocation();
 
-	// Iterate over all spacecraft locations
-	if (PlayerLocation)
+	// Get all player locations
+	TArray<FVector2D> PlayerLocations;
+	for (const FGuid& Identifier : GameState->GetPlayerSpacecraftIdentifiers())
 	{
-		for (const TPair<FGuid, FNovaOrbitalLocation>& IdentifierAndLocation : OrbitalSimulation->GetAllSpacecraftLocations())
+		const FNovaOrbitalLocation* PlayerLocation = OrbitalSimulation->GetSpacecraftLocation(Identifier);
+		if (PlayerLocation)
 		{
-			FGuid                         Identifier         = IdentifierAndLocation.Key;
-			double                        DistanceFromPlayer = IdentifierAndLocation.Value.GetDistanceTo(*PlayerLocation);
-			const FNovaAISpacecraftState* SpacecraftStatePtr = SpacecraftDatabase.Find(Identifier);
+			PlayerLocations.Add(PlayerLocation->GetCartesianLocation());
+		}
+	}
+
+	// Check a slice of the database every frame
+	if (TierUpdateQueue.Num() == 0)
+	{
+		SpacecraftDatabase.GetKeys(TierUpdateQueue);
+	}
+	const int32   UpdateCount = FMath::Min(SpacecraftTierUpdatesPerFrame, TierUpdateQueue.Num());
+	TArray<FGuid> UpdatedSpacecraft;
+	for (int32 Index = 0; Index < UpdateCount; Index++)
+	{
+		UpdatedSpacecraft.Add(TierUpdateQueue.Pop(false));
+	}
 
+	// Get the distance to the nearest player in parallel, as this only reads the AI and orbital databases
+	TArray<double> DistancesFromPlayers;
+	DistancesFromPlayers.SetNum(UpdatedSpacecraft.Num());
+	ParallelFor(
+		UpdatedSpacecraft.Num(),
+		[&](int32 Index)
+		{
+			DistancesFromPlayers[Index] = MAX_dbl;
+
+			const FNovaAISpacecraftState* SpacecraftStatePtr = SpacecraftDatabase.Find(UpdatedSpacecraft[Index]);
 			if (SpacecraftStatePtr)
 			{
-				// Spawn
-				if (!IsValid(SpacecraftStatePtr->PhysicalSpacecraft) &&
-					(Identifier == AlwaysLoadedSpacecraft || DistanceFromPlayer < SpacecraftSpawnDistanceKm))
+				const FNovaOrbitalLocation Location = GetSpacecraftLocation(UpdatedSpacecraft[Index], *SpacecraftStatePtr);
+				if (Location.IsValid())
 				{
-					ANovaSpacecraftPawn* NewSpacecraft = GetWorld()->SpawnActor<ANovaSpacecraftPawn>();
-					NCHECK(NewSpacecraft);
-					NewSpacecraft->SetSpacecraftIdentifier(Identifier);
-
-					NLOG("UNovaAISimulationComponent::ProcessSpawning : spawning '%s'", *Identifier.ToString(EGuidFormats::Short));
-
-					SpacecraftDatabase[Identifier].PhysicalSpacecraft = NewSpacecraft;
-
-					GameState->SetTimeDilation(ENovaTimeDilation::Normal);
+					const FVector2D CartesianLocation = Location.GetCartesianLocation();
+					for (const FVector2D& PlayerLocation : PlayerLocations)
+					{
+						DistancesFromPlayers[Index] =
+							FMath::Min(DistancesFromPlayers[Index], (double) FVector2D::Distance(CartesianLocation, PlayerLocation));
+					}
 				}
+			}
+		},
+		GetSimulationParallelForFlags(UpdatedSpacecraft.Num(), MinParallelTierUpdates));
 
-				// De-spawn
-				if (IsValid(SpacecraftStatePtr->PhysicalSpacecraft) && !AlwaysLoadedSpacecraft.IsValid() &&
-					DistanceFromPlayer > SpacecraftDespawnDistanceKm)
-				{
-					NLOG("UNovaAISimulationComponent::ProcessSpawning : removing '%s'", *Identifier.ToString(EGuidFormats::Short));
+	// Apply tier changes
+	for (int32 Index = 0; Index < UpdatedSpacecraft.Num(); Index++)
+	{
+		const FGuid             Identifier          = UpdatedSpacecraft[Index];
+		const double            DistanceFromPlayers = DistancesFromPlayers[Index];
+		FNovaAISpacecraftState* SpacecraftStatePtr  = SpacecraftDatabase.Find(Identifier);
+		if (SpacecraftStatePtr == nullptr)
+		{
+			continue;
+		}
 
-					SpacecraftStatePtr->PhysicalSpacecraft->Destroy();
-					SpacecraftDatabase[Identifier].PhysicalSpacecraft = nullptr;
-				}
-			}
+		// Promote
+		if (!SpacecraftStatePtr->Simulated && (Identifier == AlwaysLoadedSpacecraft || DistanceFromPlayers < SpacecraftPromotionDistance))
+		{
+			PromoteSpacecraft(Identifier, *SpacecraftStatePtr);
+		}
+
+		// Demote
+		else if (SpacecraftStatePtr->Simulated && Identifier != AlwaysLoadedSpacecraft &&
+				 !IsValid(SpacecraftStatePtr->PhysicalSpacecraft) && DistanceFromPlayers > SpacecraftDemotionDistance &&
+				 OrbitalSimulation->GetSpacecraftTrajectoryFleetSize(Identifier) <= 1)
+		{
+			DemoteSpacecraft(Identifier, *SpacecraftStatePtr);
 		}
 	}
 }
 
-void UNovaAISimulationComponent::ProcessNavigation()
+void UNovaAISimulationComponent::ProcessSpawning()
 {
 	// Get game state pointers
 	ANovaGameState* GameState = Cast<ANovaGameState>(GetOwner());
@@ -360,250 +622,1077 @@ void UNovaAISimulationComponent::ProcessNavigation()
 	UNovaOrbitalSimulationComponent* OrbitalSimulation = GameState->GetOrbitalSimulation();
 	NCHECK(OrbitalSimulation);
 
-	// Iterate over the AI database
-	for (TPair<FGuid, FNovaAISpacecraftState>& IdentifierAndSpacecraft : SpacecraftDatabase)
+	// Get all player locations
+	TArray<const FNovaOrbitalLocation*> PlayerLocations;
+	for (const FGuid& Identifier : GameState->GetPlayerSpacecraftIdentifiers())
 	{
-		// Get more game state data
-		FGuid                       Identifier      = IdentifierAndSpacecraft.Key;
-		FNovaAISpacecraftState&     SpacecraftState = IdentifierAndSpacecraft.Value;
-		const FNovaOrbitalLocation* SourceLocation  = OrbitalSimulation->GetSpacecraftLocation(Identifier);
-		const FNovaOrbit*           SourceOrbit     = OrbitalSimulation->GetSpacecraftOrbit(Identifier);
-		FNovaTime                   CurrentTime     = GameState->GetCurrentTime();
-
-		// Get the physical spacecraft movement
-		UNovaSpacecraftMovementComponent* SpacecraftMovement = nullptr;
-		if (IsValid(SpacecraftState.PhysicalSpacecraft))
+		const FNovaOrbitalLocation* PlayerLocation = OrbitalSimulation->GetSpacecraftLocation(Identifier);
+		if (PlayerLocation)
 		{
-			SpacecraftMovement = SpacecraftState.PhysicalSpacecraft->GetSpacecraftMovement();
+			PlayerLocations.Add(PlayerLocation);
 		}
+	}
+	if (PlayerLocations.Num() == 0)
+	{
+		return;
+	}
 
-		// Issue new orders
-		if (SpacecraftState.CurrentState == ENovaAISpacecraftState::Idle && SourceOrbit != nullptr)
-		{
-			const UNovaArea* TargetArea = FindArea(SourceLocation);
-			if (TargetArea)
-			{
-				// Pick the area
-				SpacecraftState.TargetArea = TargetArea;
-				NCHECK(SpacecraftState.TargetArea);
-
-				NLOG("UNovaAISimulationComponent::ProcessNavigation : '%s' now on trajectory toward '%s'",
-					*Identifier.ToString(EGuidFormats::Short), *SpacecraftState.TargetArea->Name.ToString());
-
-				// Start the travel
-				StartTrajectory(
-					*SourceOrbit, OrbitalSimulation->GetAreaOrbit(SpacecraftState.TargetArea), FNovaTime::FromSeconds(30), {Identifier});
-				SetSpacecraftState(SpacecraftState, ENovaAISpacecraftState::Trajectory);
-
-				// Run quotas again
-				ProcessQuotas();
-			}
-			else
-			{
-				SpacecraftState.TargetArea = nullptr;
-			}
-		}
+	// Iterate over all spacecraft locations
+	TArray<TPair<double, FGuid>> SpawnCandidates;
+	for (const TPair<FGuid, FNovaOrbitalLocation>& IdentifierAndLocation : OrbitalSimulation->GetAllSpacecraftLocations())
+	{
+		FGuid                   Identifier         = IdentifierAndLocation.Key;
+		FNovaAISpacecraftState* SpacecraftStatePtr = SpacecraftDatabase.Find(Identifier);
 
-		// Wait for arrival
-		else if (SpacecraftState.CurrentState == ENovaAISpacecraftState::Trajectory)
+		if (SpacecraftStatePtr)
 		{
-			// Detect arrival
-			const FNovaTrajectory* Trajectory = OrbitalSimulation->GetSpacecraftTrajectory(Identifier);
-			if ((CurrentTime - SpacecraftState.CurrentStateStartTime > FNovaTime::FromMinutes(5)) &&
-				(Trajectory == nullptr || Trajectory->GetArrivalTime() < CurrentTime))
-			{
-				NLOG("UNovaAISimulationComponent::ProcessNavigation : '%s' arriving at station", *Identifier.ToString(EGuidFormats::Short));
-
-				SetSpacecraftState(SpacecraftState, ENovaAISpacecraftState::Station);
-			}
-
-			// Align to maneuvers
-			if (IsValid(SpacecraftMovement) && SpacecraftMovement->IsIdle() && !SpacecraftMovement->IsAlignedToManeuver())
+			double DistanceFromPlayers = MAX_dbl;
+			for (const FNovaOrbitalLocation* PlayerLocation : PlayerLocations)
 			{
-				NLOG("UNovaAISimulationComponent::ProcessNavigation : '%s' aligning for maneuver",
-					*Identifier.ToString(EGuidFormats::Short));
-
-				SpacecraftMovement->AlignToManeuver();
+				DistanceFromPlayers = FMath::Min(DistanceFromPlayers, IdentifierAndLocation.Value.GetDistanceTo(*PlayerLocation));
 			}
-		}
 
-		// Stay at the station for some time
-		else if (SpacecraftState.CurrentState == ENovaAISpacecraftState::Station)
-		{
-			// Detect enough time spent & valid target available
-			if (CurrentTime - SpacecraftState.CurrentStateStartTime > FNovaTime::FromMinutes(5))
+			// Spawn later, nearest first
+			if (!IsValid(SpacecraftStatePtr->PhysicalSpacecraft) &&
+				(Identifier == AlwaysLoadedSpacecraft || DistanceFromPlayers < SpacecraftSpawnDistanceKm))
 			{
-				const UNovaArea* TargetArea = FindArea(SourceLocation);
-				if (TargetArea)
-				{
-					NLOG("UNovaAISimulationComponent::ProcessNavigation : '%s' undocking toward '%s'",
-						*Identifier.ToString(EGuidFormats::Short), *TargetArea->Name.ToString());
-
-					SpacecraftState.TargetArea = TargetArea;
-					SetSpacecraftState(SpacecraftState, ENovaAISpacecraftState::Undocking);
-				}
+				SpawnCandidates.Add(TPair<double, FGuid>(Identifier == AlwaysLoadedSpacecraft ? -1 : DistanceFromPlayers, Identifier));
 			}
 
-			// Dock if we're not already docked or undocking
-			else if (IsValid(SpacecraftMovement) && SpacecraftMovement->IsIdle() && !SpacecraftMovement->IsDockingUndocking() &&
-					 !SpacecraftMovement->IsDocked())
+			// De-spawn
+			else if (IsValid(SpacecraftStatePtr->PhysicalSpacecraft) && !AlwaysLoadedSpacecraft.IsValid() &&
+					 DistanceFromPlayers > SpacecraftDespawnDistanceKm)
 			{
-				NLOG("UNovaAISimulationComponent::ProcessNavigation : '%s' docking", *Identifier.ToString(EGuidFormats::Short));
-
-				SpacecraftMovement->Dock();
+				ReleasePhysicalSpacecraft(Identifier, *SpacecraftStatePtr);
 			}
 		}
+	}
 
-		// Check for complete undocking
-		else if (SpacecraftState.CurrentState == ENovaAISpacecraftState::Undocking)
+	// Spawn a limited amount of spacecraft per frame to avoid hitches
+	SpawnCandidates.Sort(
+		[](const TPair<double, FGuid>& A, const TPair<double, FGuid>& B)
 		{
-			// Detect no physical ship OR idle and undocked
-			if (!IsValid(SpacecraftMovement) || (SpacecraftMovement->IsIdle() && !SpacecraftMovement->IsDocked()))
-			{
-				NLOG("UNovaAISimulationComponent::ProcessNavigation : '%s' going idle", *Identifier.ToString(EGuidFormats::Short));
-
-				SetSpacecraftState(SpacecraftState, ENovaAISpacecraftState::Idle);
-			}
+			return A.Key < B.Key;
+		});
+	const int32 SpawnCount = FMath::Min(SpawnCandidates.Num(), SpacecraftSpawnsPerFrame);
+	for (int32 Index = 0; Index < SpawnCount; Index++)
+	{
+		const FGuid             Identifier      = SpawnCandidates[Index].Value;
+		FNovaAISpacecraftState& SpacecraftState = SpacecraftDatabase[Identifier];
 
-			// Undock if we're not already undocked
-			else if (IsValid(SpacecraftMovement) && SpacecraftMovement->IsIdle() && !SpacecraftMovement->IsDockingUndocking() &&
-					 SpacecraftMovement->IsDocked())
-			{
-				NLOG("UNovaAISimulationComponent::ProcessNavigation : '%s' undocking", *Identifier.ToString(EGuidFormats::Short));
+		SpacecraftState.PhysicalSpacecraft = AcquirePhysicalSpacecraft(Identifier, SpacecraftState);
+		PhysicalSpacecraftIdentifiers.Add(Identifier);
 
-				SpacecraftMovement->Undock();
-			}
-		}
+		GameState->SetTimeDilation(ENovaTimeDilation::Normal);
 	}
 }
 
-/*----------------------------------------------------
-    Helpers
-----------------------------------------------------*/
-
-void UNovaAISimulationComponent::CreateGame()
+ANovaSpacecraftPawn* UNovaAISimulationComponent::AcquirePhysicalSpacecraft(FGuid Identifier, const FNovaAISpacecraftState& SpacecraftState)
 {
-	NLOG("UNovaAISimulationComponent::CreateGame");
+	ANovaGameState* GameState = Cast<ANovaGameState>(GetOwner());
+	NCHECK(GameState);
 
-	if (GetOwner()->GetLocalRole() == ROLE_Authority)
+	// Reuse a pawn of the same class, which only needs to re-assemble the differences
+	FNovaAIPawnPool* Pool = PawnPool.Find(SpacecraftState.SpacecraftClass);
+	while (Pool && Pool->Pawns.Num() > 0)
 	{
-		// Get game state pointers
-		UNovaAssetManager* AssetManager = GetOwner()->GetGameInstance<UNovaGameInstance>()->GetAssetManager();
-		NCHECK(AssetManager);
-		ANovaGameState* GameState = Cast<ANovaGameState>(GetOwner());
-		NCHECK(GameState);
-
-		// Get asset lists
-		const class UNovaCelestialBody* DefaultPlanet =
-			AssetManager->GetAsset<UNovaCelestialBody>(FGuid("{0619238A-4DD1-E28B-5F86-A49734CEF648}"));
-		NCHECK(DefaultPlanet);
-		TArray<const UNovaAISpacecraftDescription*> SpacecraftDescriptions = AssetManager->GetAssets<UNovaAISpacecraftDescription>();
-
-		// Spawn spacecraft
-		FRandomStream RandomStream;
-		for (int32 Index = 0; Index < InitialTechnicalSpacecraftCount; Index++)
+		ANovaSpacecraftPawn* Spacecraft = Pool->Pawns.Pop(false);
+		if (IsValid(Spacecraft))
 		{
-			// Get the location
-			int32      InitialAltitude = RandomStream.RandRange(400, 1000);
-			int32      InitialPhase    = RandomStream.RandRange(0, 360);
-			FNovaOrbit Orbit           = FNovaOrbit(FNovaOrbitGeometry(DefaultPlanet, InitialAltitude, InitialPhase), FNovaTime());
+			NLOG("UNovaAISimulationComponent::AcquirePhysicalSpacecraft : reusing pawn for '%s'",
+				*Identifier.ToString(EGuidFormats::Short));
+
+			Spacecraft->SetActorHiddenInGame(false);
+			Spacecraft->SetActorEnableCollision(true);
+			Spacecraft->SetActorTickEnabled(true);
+			Spacecraft->GetSpacecraftMovement()->SetComponentTickEnabled(true);
+			Spacecraft->GetSpacecraftMovement()->Reset();
+			Spacecraft->SetSpacecraftIdentifier(Identifier);
+			GameState->RegisterSpacecraftPawn(Spacecraft);
+
+			return Spacecraft;
+		}
+	}
 
-			// Get the class
-			const UNovaAISpacecraftDescription* SpacecraftDescription =
-				SpacecraftDescriptions[RandomStream.RandHelper(SpacecraftDescriptions.Num())];
+	NLOG("UNovaAISimulationComponent::AcquirePhysicalSpacecraft : spawning '%s'", *Identifier.ToString(EGuidFormats::Short));
 
-			// Create the spacecraft
-			FNovaSpacecraft Spacecraft = SpacecraftDescription->Spacecraft;
-			Spacecraft.Name            = GetTechnicalShipName(RandomStream, Index);
-			Spacecraft.SpacecraftClass = SpacecraftDescription;
-			Spacecraft.Identifier      = FGuid::NewGuid();
+	ANovaSpacecraftPawn* NewSpacecraft = GetWorld()->SpawnActor<ANovaSpacecraftPawn>();
+	NCHECK(NewSpacecraft);
+	NewSpacecraft->SetSpacecraftIdentifier(Identifier);
 
-			// Register the spacecraft
-			SpacecraftDatabase.Add(Spacecraft.Identifier, FNovaAISpacecraftState());
-			GameState->UpdateSpacecraft(Spacecraft, &Orbit);
-		}
-	}
+	return NewSpacecraft;
 }
 
-FString UNovaAISimulationComponent::GetTechnicalShipName(FRandomStream& RandomStream, int32 Index) const
+void UNovaAISimulationComponent::ReleasePhysicalSpacecraft(FGuid Identifier, FNovaAISpacecraftState& SpacecraftState)
 {
-	FString Prefix = TechnicalNamePrefixes[RandomStream.RandHelper(TechnicalNamePrefixes.Num())];
-	FString Suffix = TechnicalNameSuffixes[RandomStream.RandHelper(TechnicalNameSuffixes.Num())];
-	return Prefix + " " + Suffix + " " + FString::FormatAsNumber(100 + Index);
-}
+	ANovaSpacecraftPawn* Spacecraft = SpacecraftState.PhysicalSpacecraft;
+	NCHECK(IsValid(Spacecraft));
 
-void UNovaAISimulationComponent::SetSpacecraftState(FNovaAISpacecraftState& State, ENovaAISpacecraftState NewState)
-{
 	ANovaGameState* GameState = Cast<ANovaGameState>(GetOwner());
 	NCHECK(GameState);
-	FNovaTime CurrentTime = GameState->GetCurrentTime();
 
-	State.CurrentState          = NewState;
-	State.CurrentStateStartTime = CurrentTime;
+	SpacecraftState.PhysicalSpacecraft = nullptr;
+	PhysicalSpacecraftIdentifiers.Remove(Identifier);
 
-	// GameState->SetTimeDilation(ENovaTimeDilation::Normal);
+	// Keep a few pawns per class around, hidden, inactive and out of the game state's registry
+	FNovaAIPawnPool& Pool = PawnPool.FindOrAdd(SpacecraftState.SpacecraftClass);
+	if (Pool.Pawns.Num() < MaxPooledSpacecraftPerClass)
+	{
+		NLOG("UNovaAISimulationComponent::ReleasePhysicalSpacecraft : pooling '%s'", *Identifier.ToString(EGuidFormats::Short));
+
+		Spacecraft->SetActorHiddenInGame(true);
+		Spacecraft->SetActorEnableCollision(false);
+		Spacecraft->SetActorTickEnabled(false);
+		Spacecraft->GetSpacecraftMovement()->SetComponentTickEnabled(false);
+		Spacecraft->GetSpacecraftMovement()->ClearState();
+		GameState->UnregisterSpacecraftPawn(Spacecraft);
+		Pool.Pawns.Add(Spacecraft);
+	}
+	else
+	{
+		NLOG("UNovaAISimulationComponent::ReleasePhysicalSpacecraft : removing '%s'", *Identifier.ToString(EGuidFormats::Short));
+
+		Spacecraft->Destroy();
+	}
 }
 
-void UNovaAISimulationComponent::StartTrajectory(
-	const FNovaOrbit& SourceOrbit, const FNovaOrbit& DestinationOrbit, FNovaTime DeltaTime, const TArray<FGuid>& Spacecraft)
+void UNovaAISimulationComponent::ProcessNavigation()
 {
-	// Get game state pointers
 	ANovaGameState* GameState = Cast<ANovaGameState>(GetOwner());
 	NCHECK(GameState);
-	UNovaOrbitalSimulationComponent* OrbitalSimulation = GameState->GetOrbitalSimulation();
-	NCHECK(OrbitalSimulation);
+	const FNovaTime CurrentTime = GameState->GetCurrentTime();
 
-	// Compute trajectory candidates
-	TArray<FNovaTrajectory>   Candidates;
-	FNovaTrajectoryParameters Parameters = OrbitalSimulation->PrepareTrajectory(SourceOrbit, DestinationOrbit, DeltaTime, Spacecraft);
-	for (float Altitude = 300; Altitude <= 1500; Altitude += 300)
+	// Collect spacecraft that are due, discarding outdated wakeups, with physical spacecraft added below
+	TArray<FGuid> DueSpacecraft;
+	DueSpacecraft.Reserve(PhysicalSpacecraftIdentifiers.Num());
+	while (WakeupQueue.Num() > 0 && WakeupQueue.HeapTop().Time <= CurrentTime)
 	{
-		FNovaTrajectory NewTrajectory = OrbitalSimulation->ComputeTrajectory(Parameters, Altitude);
-		if (NewTrajectory.IsValid() && NewTrajectory.TotalTravelDuration.AsDays() < 15)
+		FNovaAIWakeup Wakeup;
+		WakeupQueue.HeapPop(Wakeup);
+
+		FNovaAISpacecraftState* SpacecraftStatePtr = SpacecraftDatabase.Find(Wakeup.Identifier);
+		if (SpacecraftStatePtr && SpacecraftStatePtr->NextWakeTime == Wakeup.Time)
 		{
-			Candidates.Add(NewTrajectory);
+			SpacecraftStatePtr->NextWakeTime = FNovaTime::FromMinutes(-1);
+			if (!PhysicalSpacecraftIdentifiers.Contains(Wakeup.Identifier))
+			{
+				DueSpacecraft.Add(Wakeup.Identifier);
+			}
 		}
 	}
 
-	NCHECK(Candidates.Num() > 0);
+	// Physical spacecraft are always processed since they need movement orders
+	for (const FGuid& Identifier : PhysicalSpacecraftIdentifiers)
+	{
+		DueSpacecraft.Add(Identifier);
+	}
 
-	// Sort trajectories
-	Candidates.Sort(
-		[](const FNovaTrajectory& A, const FNovaTrajectory& B)
-		{
-			return A.TotalTravelDuration < B.TotalTravelDuration && A.TotalDeltaV < B.TotalDeltaV;
-		});
+	for (const FGuid& Identifier : DueSpacecraft)
+	{
+		ProcessSpacecraftNavigation(Identifier, SpacecraftDatabase[Identifier]);
+	}
 
-	// Start trajectory
-	OrbitalSimulation->CommitTrajectory(Spacecraft, Candidates[0]);
+	INC_DWORD_STAT_BY(STAT_NovaAIProcessedSpacecraft, DueSpacecraft.Num());
 }
 
-const UNovaArea* UNovaAISimulationComponent::FindArea(const FNovaOrbitalLocation* SourceLocation) const
+void UNovaAISimulationComponent::ProcessSpacecraftNavigation(FGuid Identifier, FNovaAISpacecraftState& SpacecraftState)
 {
-	NCHECK(SourceLocation != nullptr);
-
-	UNovaAssetManager* AssetManager = GetOwner()->GetGameInstance<UNovaGameInstance>()->GetAssetManager();
-	NCHECK(AssetManager);
+	// Get game state pointers
 	ANovaGameState* GameState = Cast<ANovaGameState>(GetOwner());
 	NCHECK(GameState);
 	UNovaOrbitalSimulationComponent* OrbitalSimulation = GameState->GetOrbitalSimulation();
 	NCHECK(OrbitalSimulation);
 
-	// Pick a random destination that is not the nearest one
-	TArray<const UNovaArea*> Areas           = AssetManager->GetAssets<UNovaArea>();
-	auto                     AreaAndDistance = OrbitalSimulation->GetNearestAreaAndDistance(*SourceLocation);
+	// Get more game state data
+	const FNovaOrbitalLocation   SourceLocation = GetSpacecraftLocation(Identifier, SpacecraftState);
+	const FNovaOrbit*            SourceOrbit    = GetSpacecraftOrbit(Identifier, SpacecraftState);
+	const FNovaTime              CurrentTime    = GameState->GetCurrentTime();
+	const ENovaAISpacecraftState PreviousState  = SpacecraftState.CurrentState;
 
-	// Remove the nearest destination and all areas over quota
-	Areas.Remove(AreaAndDistance.Key);
-	for (const TPair<const UNovaArea*, int32>& AreaAndQuota : AreasQuotas)
+	// Get the physical spacecraft movement
+	UNovaSpacecraftMovementComponent* SpacecraftMovement = nullptr;
+	if (IsValid(SpacecraftState.PhysicalSpacecraft))
 	{
-		if (AreaAndQuota.Value >= AreaAndQuota.Key->AIQuota)
-		{
-			Areas.Remove(AreaAndQuota.Key);
-		}
+		SpacecraftMovement = SpacecraftState.PhysicalSpacecraft->GetSpacecraftMovement();
 	}
 
-	return Areas.Num() > 0 ? Areas[FMath::RandHelper(Areas.Num())] : nullptr;
+	// Issue new orders
+	if (SpacecraftState.CurrentState == ENovaAISpacecraftState::Idle && SourceOrbit != nullptr && SourceLocation.IsValid())
+	{
+		if (QueueDeparture(Identifier, SpacecraftState, SourceLocation))
+		{
+			NLOG("UNovaAISimulationComponent::ProcessNavigation : '%s' now planning a trajectory toward '%s'",
+				*Identifier.ToString(EGuidFormats::Short), *SpacecraftState.TargetArea->Name.ToString());
+
+			// Wait for the trajectory to be computed
+			SetSpacecraftState(SpacecraftState, ENovaAISpacecraftState::Planning);
+		}
+		else
+		{
+			SetTargetArea(SpacecraftState, nullptr);
+		}
+	}
+
+	// Wait for arrival
+	else if (SpacecraftState.CurrentState == ENovaAISpacecraftState::Trajectory)
+	{
+		// Abstract spacecraft complete their own trajectories, with the same comparison as the orbital simulation
+		const FNovaTrajectory& AbstractTrajectory = SpacecraftState.Trajectory;
+		if (!SpacecraftState.Simulated && AbstractTrajectory.IsValid() && CurrentTime > AbstractTrajectory.GetArrivalTime())
+		{
+			SpacecraftState.Orbit      = SpacecraftState.Trajectory.GetFinalOrbit();
+			SpacecraftState.Trajectory = FNovaTrajectory();
+			SpacecraftState.Revision++;
+		}
+
+		// Detect arrival once the trajectory has been completed, so that the fleet orbit exists when it is split
+		const FNovaTrajectory* Trajectory = GetSpacecraftTrajectory(Identifier, SpacecraftState);
+		if ((CurrentTime - SpacecraftState.CurrentStateStartTime >= FNovaTime::FromMinutes(SpacecraftStateMinimumDurationMinutes)) &&
+			Trajectory == nullptr)
+		{
+			NLOG("UNovaAISimulationComponent::ProcessNavigation : '%s' arriving at station", *Identifier.ToString(EGuidFormats::Short));
+
+			// Fleets break up on arrival
+			if (SpacecraftState.Simulated)
+			{
+				OrbitalSimulation->SplitOrbit({Identifier});
+			}
+
+			SetSpacecraftState(SpacecraftState, ENovaAISpacecraftState::Station);
+		}
+
+		// Align to maneuvers
+		if (IsValid(SpacecraftMovement) && SpacecraftMovement->IsIdle() && !SpacecraftMovement->IsAlignedToManeuver())
+		{
+			NLOG("UNovaAISimulationComponent::ProcessNavigation : '%s' aligning for maneuver",
+				*Identifier.ToString(EGuidFormats::Short));
+
+			SpacecraftMovement->AlignToManeuver();
+		}
+	}
+
+	// Stay at the station for some time
+	else if (SpacecraftState.CurrentState == ENovaAISpacecraftState::Station)
+	{
+		// Detect enough time spent & valid target available
+		if (CurrentTime - SpacecraftState.CurrentStateStartTime >= FNovaTime::FromMinutes(SpacecraftStateMinimumDurationMinutes))
+		{
+			const UNovaArea* TargetArea = SourceLocation.IsValid() ? FindArea(SourceLocation) : nullptr;
+			if (TargetArea)
+			{
+				NLOG("UNovaAISimulationComponent::ProcessNavigation : '%s' undocking toward '%s'",
+					*Identifier.ToString(EGuidFormats::Short), *TargetArea->Name.ToString());
+
+				SetTargetArea(SpacecraftState, TargetArea);
+				SetSpacecraftState(SpacecraftState, ENovaAISpacecraftState::Undocking);
+			}
+		}
+
+		// Dock if we're not already docked or undocking
+		else if (IsValid(SpacecraftMovement) && SpacecraftMovement->IsIdle() && !SpacecraftMovement->IsDockingUndocking() &&
+				 !SpacecraftMovement->IsDocked())
+		{
+			NLOG("UNovaAISimulationComponent::ProcessNavigation : '%s' docking", *Identifier.ToString(EGuidFormats::Short));
+
+			SpacecraftMovement->Dock();
+		}
+	}
+
+	// Check for complete undocking
+	else if (SpacecraftState.CurrentState == ENovaAISpacecraftState::Undocking)
+	{
+		// Detect no physical ship OR idle and undocked
+		if (!IsValid(SpacecraftMovement) || (SpacecraftMovement->IsIdle() && !SpacecraftMovement->IsDocked()))
+		{
+			NLOG("UNovaAISimulationComponent::ProcessNavigation : '%s' going idle", *Identifier.ToString(EGuidFormats::Short));
+
+			SetSpacecraftState(SpacecraftState, ENovaAISpacecraftState::Idle);
+		}
+
+		// Undock if we're not already undocked
+		else if (IsValid(SpacecraftMovement) && SpacecraftMovement->IsIdle() && !SpacecraftMovement->IsDockingUndocking() &&
+				 SpacecraftMovement->IsDocked())
+		{
+			NLOG("UNovaAISimulationComponent::ProcessNavigation : '%s' undocking", *Identifier.ToString(EGuidFormats::Short));
+
+			SpacecraftMovement->Undock();
+		}
+	}
+
+	ScheduleWakeup(Identifier, SpacecraftState, SpacecraftState.CurrentState != PreviousState);
+}
+
+/*----------------------------------------------------
+    Helpers
+----------------------------------------------------*/
+
+void UNovaAISimulationComponent::CreateGame()
+{
+	NLOG("UNovaAISimulationComponent::CreateGame");
+
+	if (GetOwner()->GetLocalRole() == ROLE_Authority)
+	{
+		// Get game state pointers
+		UNovaAssetManager* AssetManager = GetOwner()->GetGameInstance<UNovaGameInstance>()->GetAssetManager();
+		NCHECK(AssetManager);
+
+		// Get asset lists
+		const class UNovaCelestialBody* DefaultPlanet =
+			AssetManager->GetAsset<UNovaCelestialBody>(FGuid("{0619238A-4DD1-E28B-5F86-A49734CEF648}"));
+		NCHECK(DefaultPlanet);
+		TArray<const UNovaAISpacecraftDescription*> SpacecraftDescriptions = AssetManager->GetAssets<UNovaAISpacecraftDescription>();
+
+		// Create spacecraft
+		FRandomStream RandomStream;
+		for (int32 Index = 0; Index < SpacecraftCount; Index++)
+		{
+			// Get the location
+			int32      InitialAltitude = RandomStream.RandRange(400, 1000);
+			int32      InitialPhase    = RandomStream.RandRange(0, 360);
+			FNovaOrbit Orbit           = FNovaOrbit(FNovaOrbitGeometry(DefaultPlanet, InitialAltitude, InitialPhase), FNovaTime());
+
+			// Get the class
+			const UNovaAISpacecraftDescription* SpacecraftDescription =
+				SpacecraftDescriptions[RandomStream.RandHelper(SpacecraftDescriptions.Num())];
+
+			// Register the spacecraft as abstract, the tier update will promote it when needed
+			const FGuid             Identifier      = FGuid::NewGuid();
+			FNovaAISpacecraftState& SpacecraftState = SpacecraftDatabase.Add(Identifier, FNovaAISpacecraftState());
+			SpacecraftState.SpacecraftClass         = SpacecraftDescription;
+			SpacecraftState.SpacecraftName          = GetTechnicalShipName(RandomStream, Index);
+			SpacecraftState.Orbit                   = Orbit;
+			ScheduleWakeup(Identifier, SpacecraftState, true);
+		}
+	}
+}
+
+FString UNovaAISimulationComponent::GetTechnicalShipName(FRandomStream& RandomStream, int32 Index) const
+{
+	FString Prefix = TechnicalNamePrefixes[RandomStream.RandHelper(TechnicalNamePrefixes.Num())];
+	FString Suffix = TechnicalNameSuffixes[RandomStream.RandHelper(TechnicalNameSuffixes.Num())];
+	return Prefix + " " + Suffix + " " + FString::FormatAsNumber(100 + Index);
+}
+
+void UNovaAISimulationComponent::ScheduleWakeup(FGuid Identifier, FNovaAISpacecraftState& SpacecraftState, bool StateChanged)
+{
+	ANovaGameState* GameState = Cast<ANovaGameState>(GetOwner());
+	NCHECK(GameState);
+	UNovaOrbitalSimulationComponent* OrbitalSimulation = GameState->GetOrbitalSimulation();
+	NCHECK(OrbitalSimulation);
+	const FNovaTime CurrentTime = GameState->GetCurrentTime();
+
+	// Spacecraft planning a trajectory are woken up when the computation completes
+	if (SpacecraftState.CurrentState == ENovaAISpacecraftState::Planning)
+	{
+		SpacecraftState.NextWakeTime = FNovaTime::FromMinutes(-1);
+		return;
+	}
+
+	// Find the next time at which the current state can change
+	FNovaTime WakeTime = CurrentTime;
+	if (SpacecraftState.CurrentState == ENovaAISpacecraftState::Trajectory)
+	{
+		WakeTime = SpacecraftState.CurrentStateStartTime + FNovaTime::FromMinutes(SpacecraftStateMinimumDurationMinutes);
+
+		const FNovaTrajectory* Trajectory = GetSpacecraftTrajectory(Identifier, SpacecraftState);
+		if (Trajectory && Trajectory->GetArrivalTime() > WakeTime)
+		{
+			WakeTime = Trajectory->GetArrivalTime();
+		}
+	}
+	else if (SpacecraftState.CurrentState == ENovaAISpacecraftState::Station)
+	{
+		WakeTime = SpacecraftState.CurrentStateStartTime + FNovaTime::FromMinutes(SpacecraftStateMinimumDurationMinutes);
+	}
+
+	// Abstract spacecraft are far from players and only need to progress in coarse steps, with a stable per-ship phase so that
+	// the fleet doesn't wake up all at once on the same boundaries
+	if (!SpacecraftState.Simulated && AbstractSpacecraftWakeupPeriod > 0)
+	{
+		const double Phase = (GetTypeHash(Identifier) % 1024) / 1024.0 * AbstractSpacecraftWakeupPeriod;
+		const double Steps = FMath::CeilToDouble((WakeTime.AsMinutes() - Phase) / AbstractSpacecraftWakeupPeriod);
+		WakeTime           = FNovaTime::FromMinutes(Steps * AbstractSpacecraftWakeupPeriod + Phase);
+	}
+
+	// Spacecraft that were due but could not progress try again later, unless that's already planned
+	if (WakeTime <= CurrentTime && !StateChanged)
+	{
+		if (SpacecraftState.NextWakeTime > CurrentTime)
+		{
+			return;
+		}
+
+		WakeTime = CurrentTime + FNovaTime::FromMinutes(SpacecraftRetryDelayMinutes);
+	}
+
+	// Outdated entries stay in the queue and are discarded when popped
+	if (WakeTime != SpacecraftState.NextWakeTime)
+	{
+		SpacecraftState.NextWakeTime = WakeTime;
+		WakeupQueue.HeapPush(FNovaAIWakeup{WakeTime, Identifier});
+	}
+}
+
+void UNovaAISimulationComponent::SetSpacecraftState(FNovaAISpacecraftState& State, ENovaAISpacecraftState NewState)
+{
+	ANovaGameState* GameState = Cast<ANovaGameState>(GetOwner());
+	NCHECK(GameState);
+	FNovaTime CurrentTime = GameState->GetCurrentTime();
+
+	State.CurrentState          = NewState;
+	State.CurrentStateStartTime = CurrentTime;
+	State.Revision++;
+
+	// GameState->SetTimeDilation(ENovaTimeDilation::Normal);
+}
+
+bool UNovaAISimulationComponent::QueueDeparture(
+	FGuid Identifier, FNovaAISpacecraftState& SpacecraftState, const FNovaOrbitalLocation& SourceLocation)
+{
+	ANovaGameState* GameState = Cast<ANovaGameState>(GetOwner());
+	NCHECK(GameState);
+
+	// Join a fleet leaving from the same location if its destination is still open
+	for (FNovaAIDeparture& Departure : Departures)
+	{
+		const FNovaAISpacecraftState* LeaderStatePtr = SpacecraftDatabase.Find(Departure.Identifiers[0]);
+		if (LeaderStatePtr && Departure.Simulated == SpacecraftState.Simulated && Departure.Identifiers.Num() < MaxFleetSize &&
+			IsAreaUnderQuota(Departure.TargetArea))
+		{
+			const FNovaOrbitalLocation LeaderLocation = GetSpacecraftLocation(Departure.Identifiers[0], *LeaderStatePtr);
+			if (LeaderLocation.IsValid() && LeaderLocation.GetDistanceTo(SourceLocation) < FleetMergeDistanceKm)
+			{
+				Departure.Identifiers.Add(Identifier);
+				SetTargetArea(SpacecraftState, Departure.TargetArea);
+				return true;
+			}
+		}
+	}
+
+	// Start a new fleet
+	const UNovaArea* TargetArea = FindArea(SourceLocation);
+	if (TargetArea)
+	{
+		FNovaAIDeparture Departure;
+		Departure.TargetArea  = TargetArea;
+		Departure.Time        = GameState->GetCurrentTime();
+		Departure.Simulated   = SpacecraftState.Simulated;
+		Departure.Identifiers = {Identifier};
+		Departures.Add(Departure);
+
+		SetTargetArea(SpacecraftState, TargetArea);
+		return true;
+	}
+
+	return false;
+}
+
+void UNovaAISimulationComponent::ProcessDepartures()
+{
+	// Get game state pointers
+	ANovaGameState* GameState = Cast<ANovaGameState>(GetOwner());
+	NCHECK(GameState);
+	UNovaOrbitalSimulationComponent* OrbitalSimulation = GameState->GetOrbitalSimulation();
+	NCHECK(OrbitalSimulation);
+	const FNovaTime CurrentTime = GameState->GetCurrentTime();
+
+	int32 DepartureIndex = 0;
+	while (DepartureIndex < Departures.Num())
+	{
+		const FNovaAIDeparture& Departure = Departures[DepartureIndex];
+
+		// Wait for more spacecraft to join
+		if (CurrentTime - Departure.Time < FNovaTime::FromMinutes(FleetDepartureWindowMinutes) &&
+			Departure.Identifiers.Num() < MaxFleetSize)
+		{
+			DepartureIndex++;
+			continue;
+		}
+		else if (TrajectoryJobs.Num() >= MaxTrajectoryJobsInFlight)
+		{
+			break;
+		}
+
+		// Gather the fleet around the first spacecraft still able to leave
+		TArray<FGuid>        Identifiers;
+		FNovaOrbit           FleetOrbit;
+		FNovaOrbitalLocation FleetLocation;
+		for (const FGuid& Identifier : Departure.Identifiers)
+		{
+			FNovaAISpacecraftState* SpacecraftStatePtr = SpacecraftDatabase.Find(Identifier);
+			if (SpacecraftStatePtr == nullptr || SpacecraftStatePtr->CurrentState != ENovaAISpacecraftState::Planning)
+			{
+				continue;
+			}
+
+			const FNovaOrbit*          Orbit    = GetSpacecraftOrbit(Identifier, *SpacecraftStatePtr);
+			const FNovaOrbitalLocation Location = GetSpacecraftLocation(Identifier, *SpacecraftStatePtr);
+			if (Orbit && Location.IsValid() && SpacecraftStatePtr->Simulated == Departure.Simulated &&
+				(!FleetOrbit.IsValid() || Location.GetDistanceTo(FleetLocation) < FleetMergeDistanceKm))
+			{
+				if (!FleetOrbit.IsValid())
+				{
+					FleetOrbit    = *Orbit;
+					FleetLocation = Location;
+				}
+
+				Identifiers.Add(Identifier);
+			}
+			else
+			{
+				SetTargetArea(*SpacecraftStatePtr, nullptr);
+				SetSpacecraftState(*SpacecraftStatePtr, ENovaAISpacecraftState::Idle);
+				ScheduleWakeup(Identifier, *SpacecraftStatePtr, true);
+			}
+		}
+
+		// Move the fleet to a common orbit and plan the trajectory
+		if (Identifiers.Num() > 0)
+		{
+			NLOG("UNovaAISimulationComponent::ProcessDepartures : %d spacecraft leaving for '%s'", Identifiers.Num(),
+				*Departure.TargetArea->Name.ToString());
+
+			if (Identifiers.Num() > 1)
+			{
+				if (Departure.Simulated)
+				{
+					OrbitalSimulation->SplitOrbit(Identifiers);
+					OrbitalSimulation->MergeOrbit(Identifiers, FleetOrbit);
+				}
+				else
+				{
+					for (const FGuid& Identifier : Identifiers)
+					{
+						SpacecraftDatabase[Identifier].Orbit = FleetOrbit;
+					}
+				}
+
+				for (const FGuid& Identifier : Identifiers)
+				{
+					SpacecraftDatabase[Identifier].Revision++;
+				}
+			}
+
+			const FNovaOrbit DestinationOrbit = OrbitalSimulation->GetAreaOrbit(Departure.TargetArea);
+			StartTrajectory(FleetOrbit, DestinationOrbit, FNovaTime::FromSeconds(30), Identifiers);
+		}
+
+		Departures.RemoveAt(DepartureIndex);
+	}
+}
+
+bool UNovaAISimulationComponent::StartTrajectory(
+	const FNovaOrbit& SourceOrbit, const FNovaOrbit& DestinationOrbit, FNovaTime DeltaTime, const TArray<FGuid>& Spacecraft)
+{
+	if (TrajectoryJobs.Num() >= MaxTrajectoryJobsInFlight)
+	{
+		return false;
+	}
+
+	// Get game state pointers
+	ANovaGameState* GameState = Cast<ANovaGameState>(GetOwner());
+	NCHECK(GameState);
+	UNovaOrbitalSimulationComponent* OrbitalSimulation = GameState->GetOrbitalSimulation();
+	NCHECK(OrbitalSimulation);
+
+	// Snapshot the parameters on the game thread and compute candidates in the background
+	const FNovaTrajectoryParameters Parameters =
+		OrbitalSimulation->PrepareTrajectory(SourceOrbit, DestinationOrbit, DeltaTime, Spacecraft, GetFleet(Spacecraft));
+	FNovaAITrajectoryJob            Job;
+	Job.Identifiers = Spacecraft;
+	Job.Simulated   = SpacecraftDatabase[Spacecraft[0]].Simulated;
+	Job.Source         = SourceOrbit;
+	Job.SubmissionTime = GameState->GetCurrentTime();
+	Job.CommitTick     = CurrentTick + TrajectoryJobCommitTicks;
+	Job.Attempts       = 1;
+	Job.Result         = Async(EAsyncExecution::ThreadPool,
+		[Parameters]()
+		{
+			return ComputeBestTrajectory(Parameters);
+		});
+	TrajectoryJobs.Add(MoveTemp(Job));
+
+	return true;
+}
+
+void UNovaAISimulationComponent::ProcessTrajectoryJobs()
+{
+	// Get game state pointers
+	ANovaGameState* GameState = Cast<ANovaGameState>(GetOwner());
+	NCHECK(GameState);
+	UNovaOrbitalSimulationComponent* OrbitalSimulation = GameState->GetOrbitalSimulation();
+	NCHECK(OrbitalSimulation);
+	const FNovaTime CurrentTime = GameState->GetCurrentTime();
+	CurrentTick++;
+
+	// Commit jobs in submission order, no earlier than a fixed amount of ticks after submission, and never wait for them
+	while (TrajectoryJobs.Num() > 0 && TrajectoryJobs[0].CommitTick <= CurrentTick && TrajectoryJobs[0].Result.IsReady())
+	{
+		FNovaAITrajectoryJob Job = MoveTemp(TrajectoryJobs[0]);
+		TrajectoryJobs.RemoveAt(0);
+		FNovaTrajectory Trajectory = Job.Result.Get();
+
+		// Keep the spacecraft that are still waiting on the same orbit, in the same tier
+		TArray<FGuid>    Identifiers;
+		TArray<FGuid>    FailedIdentifiers;
+		const UNovaArea* TargetArea = nullptr;
+		for (const FGuid& Identifier : Job.Identifiers)
+		{
+			FNovaAISpacecraftState* SpacecraftStatePtr = SpacecraftDatabase.Find(Identifier);
+			if (SpacecraftStatePtr && SpacecraftStatePtr->CurrentState == ENovaAISpacecraftState::Planning)
+			{
+				const FNovaOrbit* CurrentOrbit = GetSpacecraftOrbit(Identifier, *SpacecraftStatePtr);
+				if (CurrentOrbit && *CurrentOrbit == Job.Source && SpacecraftStatePtr->Simulated == Job.Simulated)
+				{
+					Identifiers.Add(Identifier);
+					TargetArea = SpacecraftStatePtr->TargetArea;
+				}
+				else
+				{
+					FailedIdentifiers.Add(Identifier);
+				}
+			}
+		}
+
+		// Game time can move faster than the computation during fast-forward, in which case the trajectory starts in the past
+		// Spacecraft leaving the fleet also invalidate the per-spacecraft thrust data
+		// Plan again in the background with the remaining spacecraft, leaving enough time for the game time spent on this job
+		if (Identifiers.Num() > 0 && Trajectory.IsValid() &&
+			(Trajectory.GetFirstManeuverStartTime() <= CurrentTime || Identifiers.Num() != Job.Identifiers.Num()))
+		{
+			const FNovaOrbit DestinationOrbit = OrbitalSimulation->GetAreaOrbit(TargetArea);
+			const FNovaTime  DeltaTime        =
+				FNovaTime::FromSeconds(30) + FNovaTime::FromMinutes(2 * (CurrentTime - Job.SubmissionTime).AsMinutes());
+			if (Job.Attempts < MaxTrajectoryJobAttempts && StartTrajectory(Job.Source, DestinationOrbit, DeltaTime, Identifiers))
+			{
+				TrajectoryJobs.Last().Attempts = Job.Attempts + 1;
+				Identifiers.Empty();
+			}
+			else
+			{
+				Trajectory = FNovaTrajectory();
+			}
+		}
+
+		// Start the travel, with simulated fleets sharing a single trajectory entry
+		if (Identifiers.Num() > 0 && Trajectory.IsValid())
+		{
+			NLOG("UNovaAISimulationComponent::ProcessTrajectoryJobs : %d spacecraft now on trajectory toward '%s'", Identifiers.Num(),
+				*TargetArea->Name.ToString());
+
+			if (Job.Simulated)
+			{
+				OrbitalSimulation->CommitTrajectory(Identifiers, Trajectory);
+			}
+
+			// Abstract spacecraft each keep their own copy with only their thrust factors, so that they can be promoted alone
+			for (int32 SpacecraftIndex = 0; SpacecraftIndex < Identifiers.Num(); SpacecraftIndex++)
+			{
+				const FGuid&            Identifier      = Identifiers[SpacecraftIndex];
+				FNovaAISpacecraftState& SpacecraftState = SpacecraftDatabase[Identifier];
+				if (!Job.Simulated)
+				{
+					SpacecraftState.Trajectory = Trajectory.GetSingleSpacecraftTrajectory(SpacecraftIndex);
+				}
+
+				SetSpacecraftState(SpacecraftState, ENovaAISpacecraftState::Trajectory);
+				ScheduleWakeup(Identifier, SpacecraftState, true);
+			}
+		}
+		else
+		{
+			FailedIdentifiers.Append(Identifiers);
+		}
+
+		// Spacecraft that couldn't travel go back to idle
+		for (const FGuid& Identifier : FailedIdentifiers)
+		{
+			NLOG("UNovaAISimulationComponent::ProcessTrajectoryJobs : '%s' failed to plan a trajectory",
+				*Identifier.ToString(EGuidFormats::Short));
+
+			FNovaAISpacecraftState& SpacecraftState = SpacecraftDatabase[Identifier];
+			SetTargetArea(SpacecraftState, nullptr);
+			SetSpacecraftState(SpacecraftState, ENovaAISpacecraftState::Idle);
+			ScheduleWakeup(Identifier, SpacecraftState, true);
+		}
+	}
+}
+
+FNovaTrajectory UNovaAISimulationComponent::ComputeBestTrajectory(const FNovaTrajectoryParameters& Parameters)
+{
+	// Compute trajectory candidates
+	TArray<FNovaTrajectory> Candidates;
+	for (float Altitude = 300; Altitude <= 1500; Altitude += 300)
+	{
+		FNovaTrajectory NewTrajectory = UNovaOrbitalSimulationComponent::ComputeTrajectory(Parameters, Altitude);
+		if (NewTrajectory.IsValid() && NewTrajectory.TotalTravelDuration.AsDays() < 15)
+		{
+			Candidates.Add(NewTrajectory);
+		}
+	}
+
+	if (Candidates.Num() == 0)
+	{
+		return FNovaTrajectory();
+	}
+
+	// Sort trajectories
+	Candidates.Sort(
+		[](const FNovaTrajectory& A, const FNovaTrajectory& B)
+		{
+			return A.TotalTravelDuration < B.TotalTravelDuration && A.TotalDeltaV < B.TotalDeltaV;
+		});
+
+	return Candidates[0];
+}
+
+/*----------------------------------------------------
+	Spacecraft tiers
+----------------------------------------------------*/
+
+FNovaSpacecraft UNovaAISimulationComponent::CreateSpacecraft(FGuid Identifier, const FNovaAISpacecraftState& SpacecraftState) const
+{
+	NCHECK(SpacecraftState.SpacecraftClass);
+
+	FNovaSpacecraft Spacecraft = SpacecraftState.SpacecraftClass->Spacecraft;
+	Spacecraft.Name            = SpacecraftState.SpacecraftName;
+	Spacecraft.SpacecraftClass = SpacecraftState.SpacecraftClass;
+	Spacecraft.Identifier      = Identifier;
+	Spacecraft.UpdatePropulsionMetrics();
+
+	return Spacecraft;
+}
+
+TArray<FNovaSpacecraftFleetEntry> UNovaAISimulationComponent::GetFleet(const TArray<FGuid>& Identifiers) const
+{
+	ANovaGameState* GameState = Cast<ANovaGameState>(GetOwner());
+	NCHECK(GameState);
+
+	TArray<FNovaSpacecraftFleetEntry> Fleet;
+	for (const FGuid& Identifier : Identifiers)
+	{
+		const FNovaSpacecraft* Spacecraft = GameState->GetSpacecraft(Identifier);
+		if (Spacecraft)
+		{
+			Fleet.Add(FNovaSpacecraftFleetEntry(Spacecraft, GameState));
+		}
+		else
+		{
+			const FNovaAISpacecraftState* SpacecraftStatePtr = SpacecraftDatabase.Find(Identifier);
+			NCHECK(SpacecraftStatePtr);
+			const FNovaSpacecraft AbstractSpacecraft = CreateSpacecraft(Identifier, *SpacecraftStatePtr);
+			Fleet.Add(FNovaSpacecraftFleetEntry(&AbstractSpacecraft));
+		}
+	}
+
+	return Fleet;
+}
+
+void UNovaAISimulationComponent::PromoteSpacecraft(FGuid Identifier, FNovaAISpacecraftState& SpacecraftState)
+{
+	ANovaGameState* GameState = Cast<ANovaGameState>(GetOwner());
+	NCHECK(GameState);
+	UNovaOrbitalSimulationComponent* OrbitalSimulation = GameState->GetOrbitalSimulation();
+	NCHECK(OrbitalSimulation);
+
+	NLOG("UNovaAISimulationComponent::PromoteSpacecraft : '%s'", *Identifier.ToString(EGuidFormats::Short));
+
+	// Register the spacecraft in the game state and orbital simulation
+	const FNovaOrbit* Orbit = SpacecraftState.Orbit.IsValid() ? &SpacecraftState.Orbit : nullptr;
+	// The spacecraft is committed alone, so its trajectory must only hold its own thrust factors
+	// Trajectories still holding a whole fleet don't record which entry is this spacecraft, and fall back to full thrust
+	GameState->UpdateSpacecraft(CreateSpacecraft(Identifier, SpacecraftState), Orbit);
+	if (SpacecraftState.Trajectory.IsValid())
+	{
+		const TArray<FNovaManeuver>& Maneuvers       = SpacecraftState.Trajectory.Maneuvers;
+		const int32                  SpacecraftIndex = Maneuvers.Num() == 0 || Maneuvers[0].ThrustFactors.Num() == 1 ? 0 : INDEX_NONE;
+		OrbitalSimulation->CommitTrajectory({Identifier}, SpacecraftState.Trajectory.GetSingleSpacecraftTrajectory(SpacecraftIndex));
+	}
+
+	SpacecraftState.Orbit      = FNovaOrbit();
+	SpacecraftState.Trajectory = FNovaTrajectory();
+	SpacecraftState.Simulated  = true;
+	SpacecraftState.Revision++;
+
+	// Resume full-rate processing
+	ScheduleWakeup(Identifier, SpacecraftState, true);
+	INC_DWORD_STAT(STAT_NovaAITierChanges);
+}
+
+void UNovaAISimulationComponent::DemoteSpacecraft(FGuid Identifier, FNovaAISpacecraftState& SpacecraftState)
+{
+	ANovaGameState* GameState = Cast<ANovaGameState>(GetOwner());
+	NCHECK(GameState);
+	UNovaOrbitalSimulationComponent* OrbitalSimulation = GameState->GetOrbitalSimulation();
+	NCHECK(OrbitalSimulation);
+
+	NLOG("UNovaAISimulationComponent::DemoteSpacecraft : '%s'", *Identifier.ToString(EGuidFormats::Short));
+
+	// Keep the orbital state locally
+	const FNovaOrbit*      Orbit           = OrbitalSimulation->GetSpacecraftOrbit(Identifier);
+	const FNovaTrajectory* Trajectory      = OrbitalSimulation->GetSpacecraftTrajectory(Identifier);
+	const int32            SpacecraftIndex = OrbitalSimulation->GetSpacecraftTrajectoryIndex(Identifier);
+	SpacecraftState.Orbit                  = Orbit ? *Orbit : FNovaOrbit();
+	SpacecraftState.Trajectory             = Trajectory ? Trajectory->GetSingleSpacecraftTrajectory(SpacecraftIndex) : FNovaTrajectory();
+	SpacecraftState.Simulated              = false;
+	SpacecraftState.Revision++;
+
+	// Unregister the spacecraft
+	OrbitalSimulation->RemoveSpacecraft(Identifier);
+	GameState->RemoveSpacecraft(Identifier);
+
+	INC_DWORD_STAT(STAT_NovaAITierChanges);
+}
+
+const FNovaOrbit* UNovaAISimulationComponent::GetSpacecraftOrbit(FGuid Identifier, const FNovaAISpacecraftState& SpacecraftState) const
+{
+	if (SpacecraftState.Simulated)
+	{
+		const ANovaGameState* GameState = Cast<ANovaGameState>(GetOwner());
+		NCHECK(GameState);
+		return GameState->GetOrbitalSimulation()->GetSpacecraftOrbit(Identifier);
+	}
+	else
+	{
+		return SpacecraftState.Orbit.IsValid() && !SpacecraftState.Trajectory.IsValid() ? &SpacecraftState.Orbit : nullptr;
+	}
+}
+
+const FNovaTrajectory* UNovaAISimulationComponent::GetSpacecraftTrajectory(
+	FGuid Identifier, const FNovaAISpacecraftState& SpacecraftState) const
+{
+	if (SpacecraftState.Simulated)
+	{
+		const ANovaGameState* GameState = Cast<ANovaGameState>(GetOwner());
+		NCHECK(GameState);
+		return GameState->GetOrbitalSimulation()->GetSpacecraftTrajectory(Identifier);
+	}
+	else
+	{
+		return SpacecraftState.Trajectory.IsValid() ? &SpacecraftState.Trajectory : nullptr;
+	}
+}
+
+FNovaOrbitalLocation UNovaAISimulationComponent::GetSpacecraftLocation(
+	FGuid Identifier, const FNovaAISpacecraftState& SpacecraftState) const
+{
+	const ANovaGameState* GameState = Cast<ANovaGameState>(GetOwner());
+	NCHECK(GameState);
+	const FNovaTime CurrentTime = GameState->GetCurrentTime();
+
+	// Simulated spacecraft already have their location computed
+	if (SpacecraftState.Simulated)
+	{
+		const FNovaOrbitalLocation* Location = GameState->GetOrbitalSimulation()->GetSpacecraftLocation(Identifier);
+		return Location ? *Location : FNovaOrbitalLocation();
+	}
+
+	// Abstract spacecraft are computed on demand
+	else if (SpacecraftState.Trajectory.IsValid())
+	{
+		return SpacecraftState.Trajectory.GetLocation(CurrentTime);
+	}
+	else if (SpacecraftState.Orbit.IsValid())
+	{
+		return SpacecraftState.Orbit.GetLocation(CurrentTime);
+	}
+
+	return FNovaOrbitalLocation();
+}
+
+void UNovaAISimulationComponent::SetTargetArea(FNovaAISpacecraftState& SpacecraftState, const UNovaArea* TargetArea)
+{
+	if (SpacecraftState.TargetArea)
+	{
+		int32* Quota = AreasQuotas.Find(SpacecraftState.TargetArea);
+		if (Quota)
+		{
+			(*Quota)--;
+		}
+	}
+
+	SpacecraftState.TargetArea = TargetArea;
+	SpacecraftState.Revision++;
+
+	if (TargetArea)
+	{
+		AreasQuotas.FindOrAdd(TargetArea)++;
+	}
+}
+
+/*----------------------------------------------------
+	Area selection
+----------------------------------------------------*/
+
+void FNovaAIAreaTable::Build(const TArray<const UNovaArea*>& NewAreas, const TArray<double>& Weights)
+{
+	NCHECK(NewAreas.Num() == Weights.Num());
+
+	const int32 Count = NewAreas.Num();
+	Areas             = NewAreas;
+	Probabilities.SetNumZeroed(Count);
+	Aliases.SetNumZeroed(Count);
+
+	double TotalWeight = 0;
+	for (double Weight : Weights)
+	{
+		TotalWeight += Weight;
+	}
+	if (TotalWeight <= 0)
+	{
+		Areas.Empty();
+		return;
+	}
+
+	// Scale weights so that the average is one, and split entries between under-full and over-full ones
+	TArray<double> ScaledWeights;
+	TArray<int32>  SmallEntries;
+	TArray<int32>  LargeEntries;
+	for (int32 Index = 0; Index < Count; Index++)
+	{
+		ScaledWeights.Add(Weights[Index] * Count / TotalWeight);
+		if (ScaledWeights[Index] < 1)
+		{
+			SmallEntries.Add(Index);
+		}
+		else
+		{
+			LargeEntries.Add(Index);
+		}
+	}
+
+	// Fill each under-full entry with an over-full one
+	while (SmallEntries.Num() > 0 && LargeEntries.Num() > 0)
+	{
+		const int32 SmallIndex = SmallEntries.Pop(false);
+		const int32 LargeIndex = LargeEntries.Pop(false);
+
+		Probabilities[SmallIndex] = ScaledWeights[SmallIndex];
+		Aliases[SmallIndex]       = LargeIndex;
+		ScaledWeights[LargeIndex] -= 1.0 - ScaledWeights[SmallIndex];
+
+		if (ScaledWeights[LargeIndex] < 1)
+		{
+			SmallEntries.Add(LargeIndex);
+		}
+		else
+		{
+			LargeEntries.Add(LargeIndex);
+		}
+	}
+
+	// Remaining entries are full, up to rounding errors
+	for (int32 Index : SmallEntries)
+	{
+		Probabilities[Index] = 1;
+	}
+	for (int32 Index : LargeEntries)
+	{
+		Probabilities[Index] = 1;
+	}
+}
+
+const UNovaArea* FNovaAIAreaTable::Draw() const
+{
+	if (Areas.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	const int32 Index = FMath::RandHelper(Areas.Num());
+	return FMath::FRand() < Probabilities[Index] ? Areas[Index] : Areas[Aliases[Index]];
+}
+
+const UNovaArea* UNovaAISimulationComponent::FindArea(const FNovaOrbitalLocation& SourceLocation)
+{
+	NCHECK(SourceLocation.IsValid());
+
+	ANovaGameState* GameState = Cast<ANovaGameState>(GetOwner());
+	NCHECK(GameState);
+	UNovaOrbitalSimulationComponent* OrbitalSimulation = GameState->GetOrbitalSimulation();
+	NCHECK(OrbitalSimulation);
+
+	// Draw weighted destinations from the nearest area until one is under quota
+	const FNovaAIAreaTable& Table = GetAreaTable(OrbitalSimulation->GetNearestAreaAndDistance(SourceLocation).Key);
+	for (int32 Attempt = 0; Attempt < AreaSelectionAttempts; Attempt++)
+	{
+		const UNovaArea* Area = Table.Draw();
+		if (Area && IsAreaUnderQuota(Area))
+		{
+			return Area;
+		}
+	}
+
+	// Most areas are full, fall back to a uniform pick among the remaining ones
+	TArray<const UNovaArea*> Areas;
+	for (const UNovaArea* Area : Table.Areas)
+	{
+		if (IsAreaUnderQuota(Area))
+		{
+			Areas.Add(Area);
+		}
+	}
+
+	return Areas.Num() > 0 ? Areas[FMath::RandHelper(Areas.Num())] : nullptr;
+}
+
+bool UNovaAISimulationComponent::IsAreaUnderQuota(const UNovaArea* Area) const
+{
+	const int32* Quota = AreasQuotas.Find(Area);
+	return Quota == nullptr || *Quota < Area->AIQuota;
+}
+
+const FNovaAIAreaTable& UNovaAISimulationComponent::GetAreaTable(const UNovaArea* SourceArea)
+{
+	UNovaAssetManager* AssetManager = GetOwner()->GetGameInstance<UNovaGameInstance>()->GetAssetManager();
+	NCHECK(AssetManager);
+
+	// Flush tables when the catalog changes
+	if (AreaTablesRevision != AssetManager->GetCatalogRevision())
+	{
+		AreaTables.Empty();
+		AreaTablesRevision = AssetManager->GetCatalogRevision();
+	}
+
+	const FNovaAIAreaTable* ExistingTable = AreaTables.Find(SourceArea);
+	if (ExistingTable)
+	{
+		return *ExistingTable;
+	}
+
+	// Weight all areas except the source
+	TArray<const UNovaArea*> Areas;
+	TArray<double>           Weights;
+	for (const UNovaArea* Area : AssetManager->GetAssets<UNovaArea>())
+	{
+		if (Area == SourceArea)
+		{
+			continue;
+		}
+
+		// Stations and trading places get more traffic
+		double Weight = Area->IsInSpace ? 1.0 : AreaStationWeight;
+		Weight *= 1.0 + AreaTradeWeight * Area->ResourceTradeMetadata.Num();
+
+		// Nearby altitude bands are preferred
+		if (SourceArea)
+		{
+			const int32 SourceBand = FMath::FloorToInt(SourceArea->Altitude / AreaAltitudeBandKm);
+			const int32 Band       = FMath::FloorToInt(Area->Altitude / AreaAltitudeBandKm);
+			Weight /= 1 + FMath::Abs(Band - SourceBand);
+		}
+
+		Areas.Add(Area);
+		Weights.Add(Weight);
+	}
+
+	NLOG("UNovaAISimulationComponent::GetAreaTable : built %d destinations from '%s'", Areas.Num(),
+		SourceArea ? *SourceArea->Name.ToString() : TEXT("none"));
+
+	FNovaAIAreaTable& Table = AreaTables.Add(SourceArea);
+	Table.Build(Areas, Weights);
+
+	return Table;
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -5,6 +5,8 @@
 #include "EngineMinimal.h"
 #include "NovaGameTypes.h"
 #include "NovaAISpacecraft.h"
+#include "NovaOrbitalSimulationTypes.h"
+#include "Async/Future.h"
 #include "NovaAISimulationComponent.generated.h"
 
 /** AI states */
@@ -13,7 +15,8 @@ enum class ENovaAISpacecraftState : uint8
 	Idle,
 	Trajectory,
 	Station,
-	Undocking
+	Undocking,
+	Planning
 };
 
 /** AI spacecraft data */
@@ -21,11 +24,30 @@ USTRUCT()
 struct FNovaAISpacecraftState
 {
 	FNovaAISpacecraftState()
-		: PhysicalSpacecraft(nullptr), TargetArea(nullptr), CurrentState(ENovaAISpacecraftState::Idle), CurrentStateStartTime(0)
+		: SpacecraftClass(nullptr)
+		, Simulated(false)
+		, PhysicalSpacecraft(nullptr)
+		, TargetArea(nullptr)
+		, CurrentState(ENovaAISpacecraftState::Idle)
+		, CurrentStateStartTime(0)
+		, NextWakeTime(FNovaTime::FromMinutes(-1))
+		, Revision(0)
 	{}
 
 	GENERATED_BODY()
 
+	UPROPERTY()
+	const class UNovaAISpacecraftDescription* SpacecraftClass;
+
+	FString SpacecraftName;
+
+	// Simulated spacecraft are registered in the game state, abstract ones only live here
+	bool Simulated;
+
+	// Abstract tier orbit & trajectory
+	FNovaOrbit      Orbit;
+	FNovaTrajectory Trajectory;
+
 	UPROPERTY()
 	class ANovaSpacecraftPawn* PhysicalSpacecraft;
 
@@ -35,6 +57,68 @@ struct FNovaAISpacecraftState
 	ENovaAISpacecraftState CurrentState;
 
 	FNovaTime CurrentStateStartTime;
+
+	FNovaTime NextWakeTime;
+
+	// Incremented on every change to the saved state, so that incremental saves can skip unchanged spacecraft
+	uint32 Revision;
+};
+
+/** Physical spacecraft kept around for reuse */
+USTRUCT()
+struct FNovaAIPawnPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<class ANovaSpacecraftPawn*> Pawns;
+};
+
+/** AI fleet waiting for more spacecraft to leave together */
+struct FNovaAIDeparture
+{
+	const class UNovaArea* TargetArea;
+	FNovaTime              Time;
+	bool                   Simulated;
+	TArray<FGuid>          Identifiers;
+};
+
+/** AI trajectory planning job */
+struct FNovaAITrajectoryJob
+{
+	TArray<FGuid>            Identifiers;
+	bool                     Simulated;
+	FNovaOrbit               Source;
+	FNovaTime                SubmissionTime;
+	int64                    CommitTick;
+	int32                    Attempts;
+	TFuture<FNovaTrajectory> Result;
+};
+
+/** AI scheduler entry */
+struct FNovaAIWakeup
+{
+	FNovaTime Time;
+	FGuid     Identifier;
+
+	bool operator<(const FNovaAIWakeup& Other) const
+	{
+		return Time < Other.Time;
+	}
+};
+
+/** Weighted random selection table for AI destinations, using the alias method */
+struct FNovaAIAreaTable
+{
+	/** Build the table from a list of areas and their relative weights */
+	void Build(const TArray<const class UNovaArea*>& NewAreas, const TArray<double>& Weights);
+
+	/** Pick a random area according to weights */
+	const class UNovaArea* Draw() const;
+
+	TArray<const class UNovaArea*> Areas;
+	TArray<double>                 Probabilities;
+	TArray<int32>                  Aliases;
 };
 
 /** AI spacecraft control component */
@@ -57,6 +141,15 @@ public:
 	static void SerializeJson(
 		TSharedPtr<struct FNovaAIStateSave>& SaveData, TSharedPtr<class FJsonObject>& JsonData, ENovaSerialize Direction);
 
+	static void SerializeBinary(TSharedPtr<struct FNovaAIStateSave>& SaveData, FArchive& Ar);
+
+	/** Write the spacecraft added, modified or removed since the given revisions, or apply them when loading.
+	 * Returns the number of spacecraft written or applied. */
+	static int32 SerializeBinaryDelta(TSharedPtr<struct FNovaAIStateSave>& SaveData, const TMap<FGuid, uint32>& Revisions, FArchive& Ar);
+
+	/** Get the revision of each spacecraft in the save data */
+	static void GetRevisions(const TSharedPtr<struct FNovaAIStateSave>& SaveData, TMap<FGuid, uint32>& Revisions);
+
 	/*----------------------------------------------------
 	    Interface
 	----------------------------------------------------*/
@@ -81,15 +174,27 @@ public:
 	----------------------------------------------------*/
 
 protected:
-	/** Update the quotas map */
+	/** Rebuild the quotas map */
 	void ProcessQuotas();
 
+	/** Promote spacecraft near players to the simulated tier, and demote distant ones to the abstract tier */
+	void ProcessTiers();
+
 	/** Handle the spawning and de-spawning of physical spacecraft */
 	void ProcessSpawning();
 
-	/** Handle travel and movement decisions for spacecraft */
+	/** Get a physical spacecraft from the pool, or spawn a new one */
+	class ANovaSpacecraftPawn* AcquirePhysicalSpacecraft(FGuid Identifier, const FNovaAISpacecraftState& SpacecraftState);
+
+	/** Return a physical spacecraft to the pool */
+	void ReleasePhysicalSpacecraft(FGuid Identifier, FNovaAISpacecraftState& SpacecraftState);
+
+	/** Handle travel and movement decisions for spacecraft that are due */
 	void ProcessNavigation();
 
+	/** Handle travel and movement decisions for a single spacecraft */
+	void ProcessSpacecraftNavigation(FGuid Identifier, FNovaAISpacecraftState& SpacecraftState);
+
 	/*----------------------------------------------------
 	    Helpers
 	----------------------------------------------------*/
@@ -101,15 +206,85 @@ protected:
 	/** Get a ship name for a tug or mining ship */
 	FString GetTechnicalShipName(FRandomStream& RandomStream, int32 Index) const;
 
+	/** Build the full spacecraft data for an AI spacecraft */
+	FNovaSpacecraft CreateSpacecraft(FGuid Identifier, const FNovaAISpacecraftState& SpacecraftState) const;
+
+	/** Get the trajectory fleet data for a group of AI spacecraft of any tier */
+	TArray<struct FNovaSpacecraftFleetEntry> GetFleet(const TArray<FGuid>& Identifiers) const;
+
+	/** Move a spacecraft to the simulated tier */
+	void PromoteSpacecraft(FGuid Identifier, FNovaAISpacecraftState& SpacecraftState);
+
+	/** Move a spacecraft to the abstract tier */
+	void DemoteSpacecraft(FGuid Identifier, FNovaAISpacecraftState& SpacecraftState);
+
+	/** Get the current orbit of a spacecraft in either tier */
+	const FNovaOrbit* GetSpacecraftOrbit(FGuid Identifier, const FNovaAISpacecraftState& SpacecraftState) const;
+
+	/** Get the current trajectory of a spacecraft in either tier */
+	const FNovaTrajectory* GetSpacecraftTrajectory(FGuid Identifier, const FNovaAISpacecraftState& SpacecraftState) const;
+
+	/** Get the current location of a spacecraft in either tier */
+	FNovaOrbitalLocation GetSpacecraftLocation(FGuid Identifier, const FNovaAISpacecraftState& SpacecraftState) const;
+
+	/** Change the spacecraft target while maintaining area quotas */
+	void SetTargetArea(FNovaAISpacecraftState& SpacecraftState, const class UNovaArea* TargetArea);
+
+	/** Register the time at which a spacecraft next needs processing */
+	void ScheduleWakeup(FGuid Identifier, FNovaAISpacecraftState& SpacecraftState, bool StateChanged);
+
 	/** Change the spacecraft state */
 	void SetSpacecraftState(FNovaAISpacecraftState& State, ENovaAISpacecraftState NewState);
 
-	/** Compute a trajectory between two orbits */
-	void StartTrajectory(const struct FNovaOrbit& SourceOrbit, const struct FNovaOrbit& DestinationOrbit, FNovaTime DeltaTime,
+	/** Join a fleet leaving from the same location, or pick a destination for a new one */
+	bool QueueDeparture(FGuid Identifier, FNovaAISpacecraftState& SpacecraftState, const struct FNovaOrbitalLocation& SourceLocation);
+
+	/** Merge departing fleets into a common orbit and start planning their trajectory */
+	void ProcessDepartures();
+
+	/** Submit a trajectory computation between two orbits, returns false if too many are already running */
+	bool StartTrajectory(const struct FNovaOrbit& SourceOrbit, const struct FNovaOrbit& DestinationOrbit, FNovaTime DeltaTime,
 		const TArray<FGuid>& Spacecraft);
 
+	/** Commit finished trajectory computations, in submission order */
+	void ProcessTrajectoryJobs();
+
+	/** Compute trajectory candidates and return the best one */
+	static FNovaTrajectory ComputeBestTrajectory(const struct FNovaTrajectoryParameters& Parameters);
+
 	/** Find an area to travel to */
-	const class UNovaArea* FindArea(const struct FNovaOrbitalLocation* SourceLocation) const;
+	const class UNovaArea* FindArea(const struct FNovaOrbitalLocation& SourceLocation);
+
+	/** Check whether an area can take more AI spacecraft */
+	bool IsAreaUnderQuota(const class UNovaArea* Area) const;
+
+	/** Get the destination table for spacecraft leaving an area */
+	const FNovaAIAreaTable& GetAreaTable(const class UNovaArea* SourceArea);
+
+	/*----------------------------------------------------
+	    Properties
+	----------------------------------------------------*/
+
+public:
+	// Amount of AI spacecraft to create in a new game
+	UPROPERTY(Category = Nova, EditDefaultsOnly)
+	int32 SpacecraftCount;
+
+	// Distance in kilometers from a player under which AI spacecraft are fully simulated
+	UPROPERTY(Category = Nova, EditDefaultsOnly)
+	float SpacecraftPromotionDistance;
+
+	// Distance in kilometers from all players over which AI spacecraft become abstract
+	UPROPERTY(Category = Nova, EditDefaultsOnly)
+	float SpacecraftDemotionDistance;
+
+	// Amount of AI spacecraft checked for promotion or demotion every frame
+	UPROPERTY(Category = Nova, EditDefaultsOnly)
+	int32 SpacecraftTierUpdatesPerFrame;
+
+	// Period in minutes on which abstract spacecraft wakeups are aligned, zero to process them at full rate
+	UPROPERTY(Category = Nova, EditDefaultsOnly)
+	float AbstractSpacecraftWakeupPeriod;
 
 	/*----------------------------------------------------
 	    Data
@@ -120,9 +295,28 @@ private:
 	UPROPERTY()
 	TMap<FGuid, FNovaAISpacecraftState> SpacecraftDatabase;
 
+	// Save data of each spacecraft at its last saved revision, shared between snapshots
+	mutable TMap<FGuid, TSharedPtr<const struct FNovaAISpacecraftStateSave>> SpacecraftSaveCache;
+
+	// Scheduling
+	TArray<FNovaAIWakeup>        WakeupQueue;
+	TSet<FGuid>                  PhysicalSpacecraftIdentifiers;
+	TArray<FNovaAIDeparture>     Departures;
+	TArray<FNovaAITrajectoryJob> TrajectoryJobs;
+	TArray<FGuid>                TierUpdateQueue;
+	int64                        CurrentTick;
+
+	// Physical spacecraft pool
+	UPROPERTY()
+	TMap<const class UNovaAISpacecraftDescription*, FNovaAIPawnPool> PawnPool;
+
 	// General state
 	TArray<FString>                     TechnicalNamePrefixes;
 	TArray<FString>                     TechnicalNameSuffixes;
 	FGuid                               AlwaysLoadedSpacecraft;
 	TMap<const class UNovaArea*, int32> AreasQuotas;
+
+	// Destination tables
+	TMap<const class UNovaArea*, FNovaAIAreaTable> AreaTables;
+	int32                                          AreaTablesRevision;
 };
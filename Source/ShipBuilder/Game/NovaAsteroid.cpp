@@ -2,13 +2,15 @@
 
 #include "NovaAsteroid.h"
 
-#include "NovaGameState.h"
-#include "NovaOrbitalSimulationComponent.h"
-
 #include "System/NovaAssetManager.h"
 
+#include "Camera/CameraTypes.h"
 #include "Components/StaticMeshComponent.h"
 
+// Definitions
+static constexpr float AsteroidStationaryThreshold = 1.0f;
+static constexpr float AsteroidOffscreenThreshold  = 1000.0f * 100.0f;
+
 /*----------------------------------------------------
     Constructor
 ----------------------------------------------------*/
@@ -20,7 +22,7 @@ ANovaAsteroid::ANovaAsteroid() : Super(), LoadingAssets(false)
 	SetRootComponent(AsteroidMesh);
 
 	// Defaults
-	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bCanEverTick = false;
 	SetReplicates(false);
 	bAlwaysRelevant = true;
 }
@@ -29,16 +31,6 @@ ANovaAsteroid::ANovaAsteroid() : Super(), LoadingAssets(false)
     Interface
 ----------------------------------------------------*/
 
-void ANovaAsteroid::Tick(float DeltaTime)
-{
-	Super::Tick(DeltaTime);
-
-	if (!IsLoadingAssets())
-	{
-		ProcessMovement();
-	}
-}
-
 void ANovaAsteroid::Initialize(const FNovaAsteroid& InAsteroid)
 {
 	// Initialize to safe defaults
@@ -63,24 +55,36 @@ void ANovaAsteroid::PostLoadInitialize()
 	LoadingAssets = false;
 }
 
-void ANovaAsteroid::ProcessMovement()
+void ANovaAsteroid::ProcessMovement(const FVector& RelativeLocation, const FMinimalViewInfo* View)
+{
+	// Stationary asteroids don't need a new transform, and off-screen ones only need to roughly follow
+	// Visibility is tested at both the previous and new locations so that asteroids entering or leaving the view are always exact
+	const bool  InView       = View && (IsInView(*View, GetActorLocation()) || IsInView(*View, RelativeLocation));
+	const float Displacement = FVector::Dist(GetActorLocation(), RelativeLocation);
+	const float Threshold    = InView ? AsteroidStationaryThreshold : AsteroidOffscreenThreshold;
+
+	if (Displacement > Threshold)
+	{
+		SetActorLocation(RelativeLocation);
+	}
+}
+
+bool ANovaAsteroid::IsInView(const FMinimalViewInfo& View, const FVector& Location) const
 {
-	// Get basic game state pointers
-	const ANovaGameState* GameState = GetWorld()->GetGameState<ANovaGameState>();
-	NCHECK(GameState);
-	const UNovaOrbitalSimulationComponent* OrbitalSimulation = GameState->GetOrbitalSimulation();
-	NCHECK(OrbitalSimulation);
-
-	// Get locations
-	const FVector2D PlayerLocation       = OrbitalSimulation->GetPlayerCartesianLocation();
-	const FVector2D AsteroidLocation     = OrbitalSimulation->GetAsteroidLocation(Asteroid.Identifier).GetCartesianLocation();
-	FVector2D       LocationInKilometers = AsteroidLocation - PlayerLocation;
-
-	// Transform the location accounting for angle and scale
-	const FVector2D PlayerDirection       = PlayerLocation.GetSafeNormal();
-	double          PlayerAngle           = 180 + FMath::RadiansToDegrees(FMath::Atan2(PlayerDirection.X, PlayerDirection.Y));
-	LocationInKilometers                  = LocationInKilometers.GetRotated(PlayerAngle);
-	const FVector RelativeOrbitalLocation = FVector(0, -LocationInKilometers.X, LocationInKilometers.Y) * 1000 * 100;
-
-	SetActorLocation(RelativeOrbitalLocation);
+	const FVector ViewToAsteroid = Location - View.Location;
+	const float   Distance       = ViewToAsteroid.Size();
+	const float   Radius         = AsteroidMesh->Bounds.SphereRadius;
+	if (Distance <= Radius)
+	{
+		return true;
+	}
+
+	// Test the bounding sphere against a cone enclosing the view frustum, using the diagonal field of view
+	const float AspectRatio  = View.AspectRatio > KINDA_SMALL_NUMBER ? View.AspectRatio : 1.0f;
+	const float DiagonalTan  = FMath::Tan(FMath::DegreesToRadians(View.FOV / 2)) * FMath::Sqrt(1 + 1 / FMath::Square(AspectRatio));
+	const float HalfFOV      = FMath::Atan(DiagonalTan);
+	const float HalfAngle    = FMath::Min(HalfFOV + FMath::Asin(Radius / Distance), PI);
+	const float ViewDotAngle = FVector::DotProduct(ViewToAsteroid / Distance, View.Rotation.Vector());
+
+	return ViewDotAngle >= FMath::Cos(HalfAngle);
 }
@@ -22,8 +22,6 @@ public:
 	    Interface
 	----------------------------------------------------*/
 
-	virtual void Tick(float DeltaTime) override;
-
 	/** Setup the asteroid effects */
 	void Initialize(const FNovaAsteroid& InAsteroid);
 
@@ -40,8 +38,11 @@ public:
 	/** Finish spawning */
 	void PostLoadInitialize();
 
-	/** Run the movement process */
-	void ProcessMovement();
+	/** Move the asteroid to its new relative location, skipping render state updates when it can't be seen from View */
+	void ProcessMovement(const FVector& RelativeLocation, const struct FMinimalViewInfo* View);
+
+	/** Check whether the asteroid would be in the camera view at Location */
+	bool IsInView(const struct FMinimalViewInfo& View, const FVector& Location) const;
 
 	/*----------------------------------------------------
 	    Components
@@ -10,28 +10,51 @@
 
 #include "Nova.h"
 
+#include "System/NovaAssetManager.h"
+
+#include "Camera/PlayerCameraManager.h"
 #include "Curves/CurveFloat.h"
+#include "Engine/StreamableManager.h"
+#include "GameFramework/PlayerController.h"
 
 // Definitions
 static constexpr int32 AltitudeDistributionValues = 100;
 static constexpr int32 IntegralValues             = 100;
 static constexpr int32 AsteroidSpawnDistanceKm    = 500;
 static constexpr int32 AsteroidDespawnDistanceKm  = 600;
+static constexpr int32 MinParallelAsteroidSearch  = 8;
 
 /*----------------------------------------------------
     Constructor
 ----------------------------------------------------*/
 
-UNovaAsteroidSimulationComponent::UNovaAsteroidSimulationComponent() : Super()
+UNovaAsteroidSimulationComponent::UNovaAsteroidSimulationComponent() : Super(), CurrentPrefetchTime(0)
 {
 	// Settings
 	PrimaryComponentTick.bCanEverTick = true;
+
+	// Defaults
+	PrefetchHorizon     = 60;
+	PrefetchSampleCount = 30;
+	PrefetchUpdateDelay = 1.0f;
+	MaxPrefetchedMemory = 128;
 }
 
 /*----------------------------------------------------
     Asteroid runtime processing
 ----------------------------------------------------*/
 
+void UNovaAsteroidSimulationComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Physical asteroids are local, non-replicated visuals : dedicated servers only need the database
+	if (IsRunningDedicatedServer())
+	{
+		SetComponentTickEnabled(false);
+	}
+}
+
 void UNovaAsteroidSimulationComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
@@ -78,6 +101,175 @@ void UNovaAsteroidSimulationComponent::TickComponent(float DeltaTime, ELevelTick
 				}
 			}
 		}
+
+		ProcessAsteroidMovement(OrbitalSimulation);
+	}
+
+	// Prefetch assets for asteroids along the player path
+	CurrentPrefetchTime += DeltaTime;
+	if (CurrentPrefetchTime > PrefetchUpdateDelay)
+	{
+		ProcessAsteroidPrefetch(OrbitalSimulation);
+		CurrentPrefetchTime = 0;
+	}
+}
+
+void UNovaAsteroidSimulationComponent::ProcessAsteroidMovement(const UNovaOrbitalSimulationComponent* OrbitalSimulation)
+{
+	// Evaluate locations at the presentation time so that movement stays smooth between simulation updates
+	const FNovaTime PresentationTime = Cast<ANovaGameState>(GetOwner())->GetPresentationTime();
+	const FVector2D PlayerLocation   = OrbitalSimulation->GetPlayerLocationAtTime(PresentationTime).GetCartesianLocation();
+
+	// Compute the player transform once for all asteroids
+	const FVector2D PlayerDirection = PlayerLocation.GetSafeNormal();
+	const double    PlayerAngle     = 180 + FMath::RadiansToDegrees(FMath::Atan2(PlayerDirection.X, PlayerDirection.Y));
+
+	// Get the local camera view so that asteroids can test their visibility at the new location
+	const APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+	const bool               HasView          = PlayerController && PlayerController->PlayerCameraManager;
+	FMinimalViewInfo         View;
+	if (HasView)
+	{
+		View = PlayerController->PlayerCameraManager->GetCameraCachePOV();
+	}
+
+	for (const TPair<FGuid, ANovaAsteroid*>& IdentifierAndAsteroid : PhysicalAsteroidDatabase)
+	{
+		ANovaAsteroid* Asteroid = IdentifierAndAsteroid.Value;
+		if (Asteroid->IsLoadingAssets())
+		{
+			continue;
+		}
+
+		// Transform the location accounting for angle and scale
+		const FNovaOrbit AsteroidOrbit           = OrbitalSimulation->GetAsteroidOrbit(AsteroidDatabase[IdentifierAndAsteroid.Key]);
+		const FVector2D  AsteroidLocation        = AsteroidOrbit.GetLocation(PresentationTime).GetCartesianLocation();
+		const FVector2D  LocationInKilometers    = (AsteroidLocation - PlayerLocation).GetRotated(PlayerAngle);
+		const FVector    RelativeOrbitalLocation = FVector(0, -LocationInKilometers.X, LocationInKilometers.Y) * 1000 * 100;
+
+		Asteroid->ProcessMovement(RelativeOrbitalLocation, HasView ? &View : nullptr);
+	}
+}
+
+void UNovaAsteroidSimulationComponent::ProcessAsteroidPrefetch(const UNovaOrbitalSimulationComponent* OrbitalSimulation)
+{
+	const FNovaOrbit*      PlayerOrbit      = OrbitalSimulation->GetPlayerOrbit();
+	const FNovaTrajectory* PlayerTrajectory = OrbitalSimulation->GetPlayerTrajectory();
+
+	TArray<FSoftObjectPath> RequiredAssets;
+
+	if ((PlayerOrbit || PlayerTrajectory) && PrefetchSampleCount > 0)
+	{
+		// Sample the player path, which is fully known while in orbit or on a committed trajectory
+		const FNovaTime   CurrentTime = OrbitalSimulation->GetCurrentTime();
+		const FNovaTime   SampleStep  = FNovaTime::FromMinutes(PrefetchHorizon / PrefetchSampleCount);
+		TArray<FVector2D> PlayerPath;
+		for (int32 SampleIndex = 1; SampleIndex <= PrefetchSampleCount; SampleIndex++)
+		{
+			const FNovaTime SampleTime = CurrentTime + SampleIndex * SampleStep;
+			PlayerPath.Add(PlayerTrajectory ? PlayerTrajectory->GetCartesianLocation(SampleTime)
+											: PlayerOrbit->GetLocation(SampleTime).GetCartesianLocation());
+		}
+
+		// Collect asteroids that aren't spawned yet
+		TArray<const FNovaAsteroid*> CandidateAsteroids;
+		for (const TPair<FGuid, FNovaAsteroid>& IdentifierAndAsteroid : AsteroidDatabase)
+		{
+			if (GetPhysicalAsteroid(IdentifierAndAsteroid.Key) == nullptr)
+			{
+				CandidateAsteroids.Add(&IdentifierAndAsteroid.Value);
+			}
+		}
+
+		// Find the first sample where each asteroid is in spawn range, in parallel as this only reads orbits
+		TArray<int32> FirstSampleInRange;
+		FirstSampleInRange.SetNum(CandidateAsteroids.Num());
+		ParallelFor(
+			CandidateAsteroids.Num(),
+			[&](int32 AsteroidIndex)
+			{
+				const FNovaAsteroid& Asteroid = *CandidateAsteroids[AsteroidIndex];
+				const FNovaOrbit     Orbit    = OrbitalSimulation->GetAsteroidOrbit(Asteroid);
+				const double         Radius   = OrbitalSimulation->GetAsteroidLocation(Asteroid.Identifier).GetCartesianLocation().Size();
+
+				FirstSampleInRange[AsteroidIndex] = INDEX_NONE;
+				for (int32 SampleIndex = 0; SampleIndex < PlayerPath.Num(); SampleIndex++)
+				{
+					// Asteroid orbits are circular, so the radial distance is a cheap lower bound on the real distance
+					const FVector2D& PlayerLocation = PlayerPath[SampleIndex];
+					if (FMath::Abs(PlayerLocation.Size() - Radius) > AsteroidSpawnDistanceKm)
+					{
+						continue;
+					}
+
+					const FNovaTime SampleTime = CurrentTime + (SampleIndex + 1) * SampleStep;
+					if (FVector2D::Distance(Orbit.GetLocation(SampleTime).GetCartesianLocation(), PlayerLocation) < AsteroidSpawnDistanceKm)
+					{
+						FirstSampleInRange[AsteroidIndex] = SampleIndex;
+						break;
+					}
+				}
+			},
+			GetSimulationParallelForFlags(CandidateAsteroids.Num(), MinParallelAsteroidSearch));
+
+		// Sort asteroids that will be in spawn range by time of arrival in range
+		TArray<TPair<int32, const FNovaAsteroid*>> UpcomingAsteroids;
+		for (int32 AsteroidIndex = 0; AsteroidIndex < CandidateAsteroids.Num(); AsteroidIndex++)
+		{
+			const int32 SampleIndex = FirstSampleInRange[AsteroidIndex];
+			if (SampleIndex != INDEX_NONE)
+			{
+				UpcomingAsteroids.Add(TPair<int32, const FNovaAsteroid*>(SampleIndex, CandidateAsteroids[AsteroidIndex]));
+			}
+		}
+		UpcomingAsteroids.StableSort(
+			[](const TPair<int32, const FNovaAsteroid*>& A, const TPair<int32, const FNovaAsteroid*>& B)
+			{
+				return A.Key < B.Key;
+			});
+
+		// Collect the assets needed soonest, within the memory budget
+		const int64 PrefetchBudget = static_cast<int64>(MaxPrefetchedMemory) * 1024 * 1024;
+		int64       PrefetchSize   = 0;
+		for (const TPair<int32, const FNovaAsteroid*>& SampleAndAsteroid : UpcomingAsteroids)
+		{
+			const FNovaAsteroid* Asteroid = SampleAndAsteroid.Value;
+			for (const FSoftObjectPath& Asset : {Asteroid->Mesh.ToSoftObjectPath(), Asteroid->DustEffect.ToSoftObjectPath()})
+			{
+				if (!RequiredAssets.Contains(Asset))
+				{
+					const int64 AssetSize = UNovaAssetManager::Get()->GetAssetSize(Asset);
+					if (PrefetchSize + AssetSize <= PrefetchBudget)
+					{
+						RequiredAssets.Add(Asset);
+						PrefetchSize += AssetSize;
+					}
+				}
+			}
+		}
+	}
+
+	// Release assets that are no longer needed
+	for (auto It = PrefetchedAssets.CreateIterator(); It; ++It)
+	{
+		if (!RequiredAssets.Contains(It.Key()))
+		{
+			if (It.Value().IsValid())
+			{
+				It.Value()->ReleaseHandle();
+			}
+			It.RemoveCurrent();
+		}
+	}
+
+	// Request new assets
+	for (const FSoftObjectPath& Asset : RequiredAssets)
+	{
+		if (!PrefetchedAssets.Contains(Asset))
+		{
+			NLOG("UNovaAsteroidSimulationComponent::ProcessAsteroidPrefetch : prefetching '%s'", *Asset.ToString());
+			PrefetchedAssets.Add(Asset, UNovaAssetManager::Get()->PrefetchAssets({Asset}));
+		}
 	}
 }
 
@@ -75,6 +75,8 @@ public:
 	    Interface
 	----------------------------------------------------*/
 
+	virtual void BeginPlay() override;
+
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	/** Reset the component */
@@ -110,9 +112,36 @@ public:
 	----------------------------------------------------*/
 
 protected:
+	/** Update the location of all physical asteroids in a single pass */
+	void ProcessAsteroidMovement(const class UNovaOrbitalSimulationComponent* OrbitalSimulation);
+
+	/** Look ahead along the player path and prefetch assets for asteroids that will come into range */
+	void ProcessAsteroidPrefetch(const class UNovaOrbitalSimulationComponent* OrbitalSimulation);
+
 	/** Check if a new asteroid can be created and get its details */
 	bool CreateAsteroid(double& Altitude, double& Phase, FNovaAsteroid& Asteroid);
 
+	/*----------------------------------------------------
+	    Properties
+	----------------------------------------------------*/
+
+public:
+	// Time in minutes to look ahead along the player path for asteroid prefetching
+	UPROPERTY(Category = Nova, EditDefaultsOnly)
+	float PrefetchHorizon;
+
+	// Amount of player locations sampled over the prefetch horizon
+	UPROPERTY(Category = Nova, EditDefaultsOnly)
+	int32 PrefetchSampleCount;
+
+	// Time in seconds between prefetch updates
+	UPROPERTY(Category = Nova, EditDefaultsOnly)
+	float PrefetchUpdateDelay;
+
+	// Maximum size in megabytes of the assets kept loaded by prefetching
+	UPROPERTY(Category = Nova, EditDefaultsOnly)
+	float MaxPrefetchedMemory;
+
 	/*----------------------------------------------------
 	    Data
 	----------------------------------------------------*/
@@ -130,4 +159,8 @@ private:
 	FGuid                             AlwaysLoadedAsteroid;
 	TMap<FGuid, FNovaAsteroid>        AsteroidDatabase;
 	TMap<FGuid, class ANovaAsteroid*> PhysicalAsteroidDatabase;
+
+	// Asset prefetching
+	float                                                       CurrentPrefetchTime;
+	TMap<FSoftObjectPath, TSharedPtr<struct FStreamableHandle>> PrefetchedAssets;
 };
@@ -173,7 +173,7 @@ AActor* ANovaGameMode::ChoosePlayerStart_Implementation(AController* Player)
 		}
 
 		// Check that the player start is not already in use
-		for (const ANovaSpacecraftPawn* SpacecraftPawn : TActorRange<ANovaSpacecraftPawn>(GetWorld()))
+		for (const ANovaSpacecraftPawn* SpacecraftPawn : GetGameState<ANovaGameState>()->GetSpacecraftPawns())
 		{
 			const UNovaSpacecraftMovementComponent* MovementComponent = SpacecraftPawn->GetSpacecraftMovement();
 			NCHECK(MovementComponent);
@@ -228,7 +228,7 @@ bool ANovaGameMode::CanFastForward(FText* AbortReason) const
 
 void ANovaGameMode::ResetSpacecraft()
 {
-	for (ANovaSpacecraftPawn* SpacecraftPawn : TActorRange<ANovaSpacecraftPawn>(GetWorld()))
+	for (ANovaSpacecraftPawn* SpacecraftPawn : GetGameState<ANovaGameState>()->GetSpacecraftPawns())
 	{
 		SpacecraftPawn->GetSpacecraftMovement()->Reset();
 	}
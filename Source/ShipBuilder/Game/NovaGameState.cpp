@@ -30,6 +30,11 @@
 
 #define LOCTEXT_NAMESPACE "ANovaGameState"
 
+#if !UE_BUILD_SHIPPING
+static TAutoConsoleVariable<int32> CVarValidateSpacecraftIndex(TEXT("nova.ValidateSpacecraftIndex"), 0,
+	TEXT("Check the spacecraft indices against all actors in the world after every change"), ECVF_Default);
+#endif    // !UE_BUILD_SHIPPING
+
 /*----------------------------------------------------
     Constructor
 ----------------------------------------------------*/
@@ -40,6 +45,8 @@ ANovaGameState::ANovaGameState()
 	, CurrentArea(nullptr)
 	, ServerTime(0)
 	, ServerTimeDilation(ENovaTimeDilation::Normal)
+	, ServerFastForwardRate(0)
+	, ServerFastForwardProgress(0)
 
 	, CurrentPriceRotation(1)
 
@@ -48,7 +55,15 @@ ANovaGameState::ANovaGameState()
 	, IsFastForward(false)
 	, TimeSinceLastFastForward(0)
 
+	, SimulationTimeAccumulator(0)
+
+	, FastForwardUpdateCost(0)
+	, ClientFastForwardStartTime(0)
+
 	, TimeSinceEvent(0)
+
+	, TimeSinceServerReport(0)
+	, FramesSinceServerReport(0)
 {
 	// Setup simulation component
 	OrbitalSimulationComponent  = CreateDefaultSubobject<UNovaOrbitalSimulationComponent>(TEXT("OrbitalSimulationComponent"));
@@ -66,14 +81,23 @@ ANovaGameState::ANovaGameState()
 	MaximumTimeCorrectionThreshold = 10.0f;
 	TimeCorrectionFactor           = 1.0f;
 
-	// Fast forward defaults : 2 days per frame in 2h steps
-	FastForwardUpdateTime      = 2 * 60;
-	FastForwardUpdatesPerFrame = 24;
-	FastForwardDelay           = 0.5;
+	// Simulation defaults
+	SimulationUpdatesPerSecond   = 30;
+	MaxSimulationUpdatesPerFrame = 8;
+
+	// Fast forward defaults : 2h steps within a 10ms frame budget
+	FastForwardUpdateTime         = 2 * 60;
+	FastForwardFrameBudget        = 10;
+	FastForwardMaxUpdatesPerFrame = 500;
+	FastForwardCostSmoothing      = 0.1f;
+	FastForwardDelay              = 0.5;
 
 	// Time defaults
 	EventNotificationDelay     = 0.5f;
 	TrajectoryEarlyRequirement = 5.0;
+
+	// Server defaults
+	ServerReportPeriod = 60;
 }
 
 /*----------------------------------------------------
@@ -181,6 +205,49 @@ void ANovaGameState::SerializeJson(TSharedPtr<FNovaGameStateSave>& SaveData, TSh
 	}
 }
 
+void ANovaGameState::SerializeBinary(TSharedPtr<FNovaGameStateSave>& SaveData, FArchive& Ar)
+{
+	if (Ar.IsLoading())
+	{
+		SaveData = MakeShared<FNovaGameStateSave>();
+	}
+
+	// General state
+	SerializeBinaryHeader(SaveData, Ar);
+
+	// AI
+	UNovaAISimulationComponent::SerializeBinary(SaveData->AIData, Ar);
+}
+
+void ANovaGameState::SerializeBinaryHeader(TSharedPtr<FNovaGameStateSave>& SaveData, FArchive& Ar)
+{
+	NCHECK(SaveData.IsValid());
+
+	UNovaAssetDescription::SerializeAsset(Ar, SaveData->CurrentArea);
+	Ar << SaveData->TimeAsMinutes;
+	Ar << SaveData->CurrentPriceRotation;
+
+	if (Ar.IsLoading() && !IsValid(SaveData->CurrentArea))
+	{
+		SaveData->CurrentArea = UNovaAssetManager::Get()->GetDefaultAsset<UNovaArea>();
+	}
+}
+
+int32 ANovaGameState::SerializeBinaryAIDelta(
+	TSharedPtr<FNovaGameStateSave>& SaveData, const TMap<FGuid, uint32>& Revisions, FArchive& Ar)
+{
+	NCHECK(SaveData.IsValid());
+
+	return UNovaAISimulationComponent::SerializeBinaryDelta(SaveData->AIData, Revisions, Ar);
+}
+
+void ANovaGameState::GetAIRevisions(const TSharedPtr<FNovaGameStateSave>& SaveData, TMap<FGuid, uint32>& Revisions)
+{
+	NCHECK(SaveData.IsValid());
+
+	UNovaAISimulationComponent::GetRevisions(SaveData->AIData, Revisions);
+}
+
 /*----------------------------------------------------
     General game state
 ----------------------------------------------------*/
@@ -207,18 +274,40 @@ void ANovaGameState::Tick(float DeltaTime)
 		FNovaTime InitialTime    = GetCurrentTime();
 		TimeSinceLastFastForward = 0;
 
-		// Run FastForwardUpdatesPerFrame loops of world updates
-		for (int32 Index = 0; Index < FastForwardUpdatesPerFrame; Index++)
+		// Run world updates until the next one would exceed the frame budget, based on the measured cost of previous updates
+		int32 UpdateCount = 0;
+		while (UpdateCount < FastForwardMaxUpdatesPerFrame)
 		{
-			bool ContinueProcessing = ProcessGameSimulation(FNovaTime::FromMinutes(FastForwardUpdateTime));
+			int64  UpdateCycles       = FPlatformTime::Cycles64();
+			bool   ContinueProcessing = ProcessGameSimulation(FNovaTime::FromMinutes(FastForwardUpdateTime));
+			double UpdateDuration     = FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - UpdateCycles);
+
+			// Track the average update cost
+			if (FastForwardUpdateCost > 0)
+			{
+				FastForwardUpdateCost = FMath::Lerp<double>(FastForwardUpdateCost, UpdateDuration, FastForwardCostSmoothing);
+			}
+			else
+			{
+				FastForwardUpdateCost = UpdateDuration;
+			}
+			UpdateCount++;
+
 			if (!ContinueProcessing)
 			{
 				NLOG("ANovaGameState::ProcessTime : fast-forward stopping at %.2f", ServerTime);
 				IsFastForward = false;
 				break;
 			}
+			else if (FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Cycles) + FastForwardUpdateCost > FastForwardFrameBudget)
+			{
+				break;
+			}
 		}
 
+		// Nothing to interpolate after a fast forward
+		PreviousSimulationTime = GetCurrentTime();
+
 		// Check the time jump
 		FNovaTime FastForwardDeltaTime = GetCurrentTime() - InitialTime;
 		if (FastForwardDeltaTime > FNovaTime::FromMinutes(1))
@@ -227,14 +316,48 @@ void ANovaGameState::Tick(float DeltaTime)
 			TimeSinceEvent = 0;
 		}
 
-		NLOG("ANovaGameState::Tick : processed fast-forward frame in %.2fms",
+		// Share the simulation rate and progress with clients so that they can follow the fast forward smoothly
+		if (IsFastForward)
+		{
+			const double ElapsedMinutes = (GetCurrentTime() - FastForwardStartTime).AsMinutes();
+			const double TotalMinutes   = ElapsedMinutes + GetTimeLeftUntilEvent().AsMinutes();
+
+			ServerFastForwardRate     = FastForwardDeltaTime.AsMinutes() / FMath::Max(DeltaTime, KINDA_SMALL_NUMBER);
+			ServerFastForwardProgress = TotalMinutes > 0 ? FMath::Clamp(ElapsedMinutes / TotalMinutes, 0.0, 1.0) : 1.0;
+		}
+		else
+		{
+			ServerFastForwardRate     = 0;
+			ServerFastForwardProgress = 0;
+		}
+
+		NLOG("ANovaGameState::Tick : processed %d fast-forward updates in %.2fms", UpdateCount,
 			FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Cycles));
 	}
 
-	// Process real-time simulation
+	// Process real-time simulation at a fixed rate
 	else
 	{
-		ProcessGameSimulation(FNovaTime::FromSeconds(static_cast<double>(DeltaTime)));
+		NCHECK(SimulationUpdatesPerSecond > 0);
+		const float SimulationStepTime = 1.0f / SimulationUpdatesPerSecond;
+		SimulationTimeAccumulator += DeltaTime;
+
+		int32 UpdateCount = 0;
+		while (SimulationTimeAccumulator >= SimulationStepTime && UpdateCount < MaxSimulationUpdatesPerFrame)
+		{
+			PreviousSimulationTime = GetCurrentTime();
+			ProcessGameSimulation(FNovaTime::FromSeconds(static_cast<double>(SimulationStepTime)));
+
+			SimulationTimeAccumulator -= SimulationStepTime;
+			UpdateCount++;
+		}
+
+		// Drop the time we can't catch up with rather than accumulating it forever
+		if (UpdateCount == MaxSimulationUpdatesPerFrame && SimulationTimeAccumulator >= SimulationStepTime)
+		{
+			NLOG("ANovaGameState::Tick : dropping %.2fs of simulation", SimulationTimeAccumulator - SimulationStepTime);
+			SimulationTimeAccumulator = SimulationStepTime;
+		}
 
 		TimeSinceLastFastForward += DeltaTime;
 	}
@@ -242,6 +365,12 @@ void ANovaGameState::Tick(float DeltaTime)
 	// Update event notification
 	ProcessPlayerEvents(DeltaTime);
 
+	// Report server resource usage
+	if (IsRunningDedicatedServer())
+	{
+		ProcessServerReport(DeltaTime);
+	}
+
 	// Update sessions
 	UNovaSessionsManager* SessionsManager = GetGameInstance<UNovaGameInstance>()->GetSessionsManager();
 	SessionsManager->SetSessionAdvertised(IsJoinable());
@@ -489,9 +618,10 @@ void ANovaGameState::UpdateSpacecraft(const FNovaSpacecraft& Spacecraft, const F
 
 bool ANovaGameState::IsAnySpacecraftDocked() const
 {
-	for (const ANovaSpacecraftPawn* SpacecraftPawn : TActorRange<ANovaSpacecraftPawn>(GetWorld()))
+	for (const ANovaSpacecraftPawn* SpacecraftPawn : SpacecraftPawns)
 	{
-		if (SpacecraftPawn->IsDocked())
+		// Pooled AI pawns are only unregistered on the server, clients skip them as hidden
+		if (!SpacecraftPawn->IsHidden() && SpacecraftPawn->IsDocked())
 		{
 			return true;
 		}
@@ -502,9 +632,9 @@ bool ANovaGameState::IsAnySpacecraftDocked() const
 
 bool ANovaGameState::AreAllSpacecraftDocked() const
 {
-	for (const ANovaSpacecraftPawn* SpacecraftPawn : TActorRange<ANovaSpacecraftPawn>(GetWorld()))
+	for (const ANovaSpacecraftPawn* SpacecraftPawn : SpacecraftPawns)
 	{
-		if (!SpacecraftPawn->IsDocked())
+		if (!SpacecraftPawn->IsHidden() && !SpacecraftPawn->IsDocked())
 		{
 			return false;
 		}
@@ -517,19 +647,81 @@ UActorComponent* ANovaGameState::GetSpacecraftSystem(
 {
 	NCHECK(Spacecraft);
 
-	// TODO : not super clean, could warrant a physical spacecraft table
-
-	for (const ANovaSpacecraftPawn* SpacecraftPawn : TActorRange<ANovaSpacecraftPawn>(GetWorld()))
+	const TArray<UActorComponent*>* Systems = SpacecraftSystemIndex.Find(GetSpacecraftPawn(Spacecraft->Identifier));
+	if (Systems)
 	{
-		if (::IsValid(SpacecraftPawn) && SpacecraftPawn->GetSpacecraftIdentifier() == Spacecraft->Identifier)
+		for (UActorComponent* System : *Systems)
 		{
-			return SpacecraftPawn->FindComponentByClass(ComponentClass);
+			if (System->IsA(ComponentClass))
+			{
+				return System;
+			}
 		}
 	}
 
 	return nullptr;
 }
 
+void ANovaGameState::RegisterSpacecraftPawn(ANovaSpacecraftPawn* Pawn)
+{
+	NCHECK(IsValid(Pawn));
+
+	SpacecraftPawns.AddUnique(Pawn);
+	IndexSpacecraftPawn(Pawn);
+	ValidateSpacecraftIndex();
+}
+
+void ANovaGameState::UnregisterSpacecraftPawn(ANovaSpacecraftPawn* Pawn)
+{
+	NCHECK(Pawn);
+
+	SpacecraftPawns.Remove(Pawn);
+	UnindexSpacecraftPawn(Pawn);
+	ValidateSpacecraftIndex();
+}
+
+void ANovaGameState::RegisterSpacecraftSystem(INovaSpacecraftSystemInterface* System)
+{
+	NCHECK(System);
+
+	SpacecraftSystems.AddUnique(System);
+
+	UActorComponent* Component = Cast<UActorComponent>(System);
+	NCHECK(Component);
+	SpacecraftSystemIndex.FindOrAdd(System->GetSpacecraftPawn()).AddUnique(Component);
+}
+
+void ANovaGameState::UnregisterSpacecraftSystem(INovaSpacecraftSystemInterface* System)
+{
+	NCHECK(System);
+
+	SpacecraftSystems.Remove(System);
+
+	const ANovaSpacecraftPawn* Pawn    = System->GetSpacecraftPawn();
+	TArray<UActorComponent*>*  Systems = SpacecraftSystemIndex.Find(Pawn);
+	if (Systems)
+	{
+		Systems->Remove(Cast<UActorComponent>(System));
+		if (Systems->Num() == 0)
+		{
+			SpacecraftSystemIndex.Remove(Pawn);
+		}
+	}
+}
+
+void ANovaGameState::OnSpacecraftPawnChanged(ANovaSpacecraftPawn* Pawn)
+{
+	NCHECK(Pawn);
+
+	// Pooled AI pawns can change identifier while unregistered on the server
+	if (SpacecraftPawns.Contains(Pawn))
+	{
+		UnindexSpacecraftPawn(Pawn);
+		IndexSpacecraftPawn(Pawn);
+		ValidateSpacecraftIndex();
+	}
+}
+
 /*----------------------------------------------------
     Time management
 ----------------------------------------------------*/
@@ -546,6 +738,33 @@ FNovaTime ANovaGameState::GetCurrentTime() const
 	}
 }
 
+FNovaTime ANovaGameState::GetPresentationTime() const
+{
+	const FNovaTime CurrentTime = GetCurrentTime();
+	const FNovaTime StepTime    = CurrentTime - PreviousSimulationTime;
+
+	// Don't interpolate across time jumps, or backwards when the client time is corrected
+	const FNovaTime MaxStepTime = FNovaTime::FromSeconds(2.0 * GetCurrentTimeDilationValue() / FMath::Max(SimulationUpdatesPerSecond, 1));
+	if (StepTime <= FNovaTime() || StepTime > MaxStepTime)
+	{
+		return CurrentTime;
+	}
+
+	return PreviousSimulationTime + StepTime * GetSimulationAlpha();
+}
+
+float ANovaGameState::GetSimulationAlpha() const
+{
+	if (IsFastForward || ServerFastForwardRate > 0)
+	{
+		return 1.0f;
+	}
+	else
+	{
+		return FMath::Clamp(SimulationTimeAccumulator * SimulationUpdatesPerSecond, 0.0f, 1.0f);
+	}
+}
+
 FNovaTime ANovaGameState::GetTimeLeftUntilEvent() const
 {
 	const ANovaGameMode* GameMode      = GetWorld()->GetAuthGameMode<ANovaGameMode>();
@@ -566,7 +785,9 @@ void ANovaGameState::FastForward()
 {
 	NLOG("ANovaGameState::FastForward");
 	SetTimeDilation(ENovaTimeDilation::Normal);
-	IsFastForward = true;
+	IsFastForward             = true;
+	FastForwardStartTime      = GetCurrentTime();
+	ServerFastForwardProgress = 0;
 }
 
 bool ANovaGameState::CanFastForward(FText* AbortReason) const
@@ -622,11 +843,11 @@ bool ANovaGameState::CanDilateTime(ENovaTimeDilation Dilation) const
 
 bool ANovaGameState::ProcessGameSimulation(FNovaTime DeltaTime)
 {
-	// Update spacecraft
+	// Update spacecraft that were modified since the last step
 	SpacecraftDatabase.UpdateCache();
 	for (FNovaSpacecraft& Spacecraft : SpacecraftDatabase.Get())
 	{
-		Spacecraft.UpdatePropulsionMetrics();
+		Spacecraft.UpdatePropulsionMetricsIfModified();
 	}
 
 	// Update the time with the base delta time that will be affected by time dilation
@@ -645,17 +866,13 @@ bool ANovaGameState::ProcessGameSimulation(FNovaTime DeltaTime)
 	// Update spacecraft systems
 	if (GetLocalRole() == ROLE_Authority)
 	{
-		for (ANovaSpacecraftPawn* Pawn : TActorRange<ANovaSpacecraftPawn>(GetWorld()))
+		const FNovaTime CurrentTime = GetCurrentTime();
+
+		for (INovaSpacecraftSystemInterface* System : SpacecraftSystems)
 		{
-			if (Pawn->GetPlayerState() != nullptr)
+			if (System->GetSpacecraftPawn()->GetPlayerState() != nullptr)
 			{
-				TArray<UActorComponent*> Components = Pawn->GetComponentsByInterface(UNovaSpacecraftSystemInterface::StaticClass());
-				for (UActorComponent* Component : Components)
-				{
-					INovaSpacecraftSystemInterface* System = Cast<INovaSpacecraftSystemInterface>(Component);
-					NCHECK(System);
-					System->Update(InitialTime, GetCurrentTime());
-				}
+				System->Update(InitialTime, CurrentTime);
 			}
 		}
 	}
@@ -702,6 +919,10 @@ bool ANovaGameState::ProcessGameTime(FNovaTime DeltaTime)
 	{
 		ServerTime += DilatedDeltaTime;
 	}
+	else if (ServerFastForwardRate > 0)
+	{
+		ClientTime = FMath::Min(ClientTime + ServerFastForwardRate * DeltaTime.AsSeconds(), ServerTime);
+	}
 	else
 	{
 		ClientTime += DilatedDeltaTime * ClientAdditionalTimeDilation;
@@ -755,6 +976,26 @@ void ANovaGameState::ProcessPlayerEvents(float DeltaTime)
 	}
 }
 
+void ANovaGameState::ProcessServerReport(float DeltaTime)
+{
+	TimeSinceServerReport += DeltaTime;
+	FramesSinceServerReport++;
+
+	if (ServerReportPeriod > 0 && TimeSinceServerReport > ServerReportPeriod)
+	{
+		const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+		const FCPUTime             CPUTime     = FPlatformTime::GetCPUTime();
+
+		NLOG("ANovaGameState::ProcessServerReport : %d players, %d spacecraft, %.1f MB used (%.1f MB peak), %.1f%% CPU, %.2fms per frame",
+			PlayerArray.Num(), SpacecraftDatabase.Get().Num(), MemoryStats.UsedPhysical / (1024.0 * 1024.0),
+			MemoryStats.PeakUsedPhysical / (1024.0 * 1024.0), CPUTime.CPUTimePct,
+			1000.0f * TimeSinceServerReport / FMath::Max(FramesSinceServerReport, 1));
+
+		TimeSinceServerReport   = 0;
+		FramesSinceServerReport = 0;
+	}
+}
+
 void ANovaGameState::ProcessTrajectoryAbort()
 {
 	const FNovaTrajectory* PlayerTrajectory = OrbitalSimulationComponent->GetPlayerTrajectory();
@@ -786,7 +1027,7 @@ void ANovaGameState::ProcessTrajectoryAbort()
 
 ENovaTrajectoryAction ANovaGameState::CheckTrajectoryAbort(FText* AbortReason) const
 {
-	for (const ANovaSpacecraftPawn* Pawn : TActorRange<ANovaSpacecraftPawn>(GetWorld()))
+	for (const ANovaSpacecraftPawn* Pawn : SpacecraftPawns)
 	{
 		if (Pawn->GetPlayerState())
 		{
@@ -822,11 +1063,89 @@ ENovaTrajectoryAction ANovaGameState::CheckTrajectoryAbort(FText* AbortReason) c
 	return ENovaTrajectoryAction::Continue;
 }
 
+void ANovaGameState::IndexSpacecraftPawn(ANovaSpacecraftPawn* Pawn)
+{
+	const FGuid Identifier = Pawn->GetSpacecraftIdentifier();
+	if (!Identifier.IsValid())
+	{
+		return;
+	}
+
+	// Pooled AI pawns are hidden on clients and may share an identifier with an active one
+	ANovaSpacecraftPawn* IndexedPawn = SpacecraftPawnIndex.FindRef(Identifier);
+	if (IndexedPawn && IndexedPawn != Pawn)
+	{
+		if (Pawn->IsHidden())
+		{
+			return;
+		}
+		UnindexSpacecraftPawn(IndexedPawn);
+	}
+
+	SpacecraftPawnIdentifiers.Add(Pawn, Identifier);
+	SpacecraftPawnIndex.Add(Identifier, Pawn);
+
+	ANovaPlayerState* PlayerState = Pawn->GetPlayerState<ANovaPlayerState>();
+	if (IsValid(PlayerState))
+	{
+		SpacecraftPlayerStateIndex.Add(Identifier, PlayerState);
+	}
+}
+
+void ANovaGameState::UnindexSpacecraftPawn(ANovaSpacecraftPawn* Pawn)
+{
+	FGuid Identifier;
+	if (SpacecraftPawnIdentifiers.RemoveAndCopyValue(Pawn, Identifier))
+	{
+		SpacecraftPawnIndex.Remove(Identifier);
+		SpacecraftPlayerStateIndex.Remove(Identifier);
+	}
+}
+
+void ANovaGameState::ValidateSpacecraftIndex() const
+{
+#if !UE_BUILD_SHIPPING
+	if (CVarValidateSpacecraftIndex.GetValueOnGameThread() == 0)
+	{
+		return;
+	}
+
+	for (const ANovaSpacecraftPawn* Pawn : TActorRange<ANovaSpacecraftPawn>(GetWorld()))
+	{
+		if (Pawn->HasActorBegunPlay() && !Pawn->IsActorBeingDestroyed() && !Pawn->IsHidden())
+		{
+			NCHECK(SpacecraftPawns.Contains(Pawn));
+
+			const FGuid Identifier = Pawn->GetSpacecraftIdentifier();
+			if (Identifier.IsValid())
+			{
+				NCHECK(GetSpacecraftPawn(Identifier) == Pawn);
+				NCHECK(GetSpacecraftPlayerState(Identifier) == Pawn->GetPlayerState<ANovaPlayerState>());
+			}
+		}
+	}
+
+	NCHECK(SpacecraftPawnIdentifiers.Num() == SpacecraftPawnIndex.Num());
+	for (const TPair<FGuid, ANovaSpacecraftPawn*>& Entry : SpacecraftPawnIndex)
+	{
+		NCHECK(SpacecraftPawns.Contains(Entry.Value));
+		NCHECK(SpacecraftPawnIdentifiers.FindRef(Entry.Value) == Entry.Key);
+		NCHECK(Entry.Value->GetSpacecraftIdentifier() == Entry.Key);
+	}
+#endif    // !UE_BUILD_SHIPPING
+}
+
 void ANovaGameState::OnServerTimeReplicated()
 {
 	const APlayerController* PC = GetGameInstance()->GetFirstLocalPlayerController();
 	NCHECK(IsValid(PC) && PC->IsLocalController());
 
+	// Under fast forward, the client time follows the server's simulation rate up to the last known server time
+	if (ServerFastForwardRate > 0)
+	{
+		return;
+	}
+
 	// Evaluate the current server time
 	const double PingSeconds      = UNovaActorTools::GetPlayerLatency(PC);
 	const double RealServerTime   = ServerTime + PingSeconds / 60.0;
@@ -866,6 +1185,29 @@ void ANovaGameState::OnCurrentAreaReplicated()
 	TimeSinceEvent = 0;
 }
 
+void ANovaGameState::OnFastForwardReplicated(float PreviousFastForwardRate)
+{
+	// Starting fast forward
+	if (PreviousFastForwardRate == 0 && ServerFastForwardRate > 0)
+	{
+		NLOG("ANovaGameState::OnFastForwardReplicated : fast-forward started at %.2f", ClientTime);
+
+		ClientFastForwardStartTime = ClientTime;
+	}
+
+	// Stopping fast forward, notify the complete time jump and let the time correction catch up
+	else if (PreviousFastForwardRate > 0 && ServerFastForwardRate == 0)
+	{
+		NLOG("ANovaGameState::OnFastForwardReplicated : fast-forward stopped at %.2f", ServerTime);
+
+		TimeJumpEvents.Add(FNovaTime::FromMinutes(ServerTime - ClientFastForwardStartTime));
+		TimeSinceEvent = 0;
+
+		ClientTime                   = FMath::Max(ClientTime, ServerTime);
+		ClientAdditionalTimeDilation = 1.0;
+	}
+}
+
 void ANovaGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
@@ -876,6 +1218,8 @@ void ANovaGameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLi
 	DOREPLIFETIME(ANovaGameState, PlayerSpacecraftIdentifiers);
 	DOREPLIFETIME(ANovaGameState, ServerTime);
 	DOREPLIFETIME(ANovaGameState, ServerTimeDilation);
+	DOREPLIFETIME(ANovaGameState, ServerFastForwardRate);
+	DOREPLIFETIME(ANovaGameState, ServerFastForwardProgress);
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -47,6 +47,18 @@ public:
 	static void SerializeJson(
 		TSharedPtr<struct FNovaGameStateSave>& SaveData, TSharedPtr<class FJsonObject>& JsonData, ENovaSerialize Direction);
 
+	static void SerializeBinary(TSharedPtr<struct FNovaGameStateSave>& SaveData, FArchive& Ar);
+
+	/** Serialize only the general state, time included, without the AI */
+	static void SerializeBinaryHeader(TSharedPtr<struct FNovaGameStateSave>& SaveData, FArchive& Ar);
+
+	/** Serialize the AI spacecraft that changed since the given revisions */
+	static int32 SerializeBinaryAIDelta(
+		TSharedPtr<struct FNovaGameStateSave>& SaveData, const TMap<FGuid, uint32>& Revisions, FArchive& Ar);
+
+	/** Get the revision of each AI spacecraft in the save data */
+	static void GetAIRevisions(const TSharedPtr<struct FNovaGameStateSave>& SaveData, TMap<FGuid, uint32>& Revisions);
+
 	/*----------------------------------------------------
 	    General game state
 	----------------------------------------------------*/
@@ -150,6 +162,41 @@ public:
 	/** Get a component of the linked spacecraft pawn if any */
 	UActorComponent* GetSpacecraftSystem(const struct FNovaSpacecraft* Spacecraft, TSubclassOf<UActorComponent> ComponentClass) const;
 
+	/** Get the pawn for a spacecraft identifier if any */
+	class ANovaSpacecraftPawn* GetSpacecraftPawn(const FGuid& Identifier) const
+	{
+		class ANovaSpacecraftPawn* const* Pawn = SpacecraftPawnIndex.Find(Identifier);
+		return Pawn ? *Pawn : nullptr;
+	}
+
+	/** Get the player state owning a spacecraft identifier if any */
+	class ANovaPlayerState* GetSpacecraftPlayerState(const FGuid& Identifier) const
+	{
+		class ANovaPlayerState* const* PlayerState = SpacecraftPlayerStateIndex.Find(Identifier);
+		return PlayerState ? *PlayerState : nullptr;
+	}
+
+	/** Get all spacecraft pawns currently in play */
+	const TArray<class ANovaSpacecraftPawn*>& GetSpacecraftPawns() const
+	{
+		return SpacecraftPawns;
+	}
+
+	/** Register a spacecraft pawn for lookups */
+	void RegisterSpacecraftPawn(class ANovaSpacecraftPawn* Pawn);
+
+	/** Unregister a spacecraft pawn */
+	void UnregisterSpacecraftPawn(class ANovaSpacecraftPawn* Pawn);
+
+	/** Register a spacecraft system for updates and lookups */
+	void RegisterSpacecraftSystem(class INovaSpacecraftSystemInterface* System);
+
+	/** Unregister a spacecraft system */
+	void UnregisterSpacecraftSystem(class INovaSpacecraftSystemInterface* System);
+
+	/** Signal that a spacecraft pawn changed its identifier or owner */
+	void OnSpacecraftPawnChanged(class ANovaSpacecraftPawn* Pawn);
+
 	/*----------------------------------------------------
 	    Time management
 	----------------------------------------------------*/
@@ -157,6 +204,12 @@ public:
 	/** Get the current game time */
 	FNovaTime GetCurrentTime() const;
 
+	/** Get the game time interpolated between the previous and current simulation steps, for presentation only */
+	FNovaTime GetPresentationTime() const;
+
+	/** Get the progress between the previous and current simulation steps, from 0 to 1 */
+	float GetSimulationAlpha() const;
+
 	/** Get the time left until the next event */
 	FNovaTime GetTimeLeftUntilEvent() const;
 
@@ -172,6 +225,12 @@ public:
 		return IsFastForward;
 	}
 
+	/** Get the progress of the current time skip towards the next event, on server and clients */
+	float GetFastForwardProgress() const
+	{
+		return ServerFastForwardProgress;
+	}
+
 	/** Get the current time dilation factor */
 	void SetTimeDilation(ENovaTimeDilation Dilation);
 
@@ -217,12 +276,24 @@ protected:
 	/** Notify events to the player*/
 	void ProcessPlayerEvents(float DeltaTime);
 
+	/** Periodically log the resource usage of dedicated servers */
+	void ProcessServerReport(float DeltaTime);
+
 	/** Automatically abort failed trajectories */
 	void ProcessTrajectoryAbort();
 
 	/** Check if all player spacecraft can currently maneuver */
 	ENovaTrajectoryAction CheckTrajectoryAbort(FText* AbortReason = nullptr) const;
 
+	/** Add a registered pawn to the identifier-based pawn and player indices */
+	void IndexSpacecraftPawn(class ANovaSpacecraftPawn* Pawn);
+
+	/** Remove a pawn from the identifier-based pawn and player indices */
+	void UnindexSpacecraftPawn(class ANovaSpacecraftPawn* Pawn);
+
+	/** Check the spacecraft indices against the actors in the world, when enabled */
+	void ValidateSpacecraftIndex() const;
+
 	/** Server replication event for time reconciliation */
 	UFUNCTION()
 	void OnServerTimeReplicated();
@@ -231,6 +302,10 @@ protected:
 	UFUNCTION()
 	void OnCurrentAreaReplicated();
 
+	/** Server replication event for fast forward */
+	UFUNCTION()
+	void OnFastForwardReplicated(float PreviousFastForwardRate);
+
 	/*----------------------------------------------------
 	    Properties
 	----------------------------------------------------*/
@@ -248,13 +323,29 @@ protected:
 	UPROPERTY(Category = Nova, EditDefaultsOnly)
 	float TimeCorrectionFactor;
 
+	// Number of simulation updates per second in real time
+	UPROPERTY(Category = Nova, EditDefaultsOnly, meta = (ClampMin = "1"))
+	int32 SimulationUpdatesPerSecond;
+
+	// Maximum number of simulation updates to catch up with in a single frame
+	UPROPERTY(Category = Nova, EditDefaultsOnly)
+	int32 MaxSimulationUpdatesPerFrame;
+
 	// Time between simulation updates during fast forward in minutes
 	UPROPERTY(Category = Nova, EditDefaultsOnly)
 	int32 FastForwardUpdateTime;
 
-	// Number of update steps to run per frame under fast forward
+	// Time budget in milliseconds for update steps per frame under fast forward
 	UPROPERTY(Category = Nova, EditDefaultsOnly)
-	int32 FastForwardUpdatesPerFrame;
+	float FastForwardFrameBudget;
+
+	// Maximum number of update steps to run per frame under fast forward
+	UPROPERTY(Category = Nova, EditDefaultsOnly)
+	int32 FastForwardMaxUpdatesPerFrame;
+
+	// Smoothing factor for the measured cost of update steps under fast forward
+	UPROPERTY(Category = Nova, EditDefaultsOnly)
+	float FastForwardCostSmoothing;
 
 	// Time in seconds to wait in loading after a fast forward
 	UPROPERTY(Category = Nova, EditDefaultsOnly)
@@ -268,6 +359,10 @@ protected:
 	UPROPERTY(Category = Nova, EditDefaultsOnly)
 	float TrajectoryEarlyRequirement;
 
+	// Time in seconds between resource usage reports on dedicated servers, zero to disable
+	UPROPERTY(Category = Nova, EditDefaultsOnly)
+	float ServerReportPeriod;
+
 	/*----------------------------------------------------
 	    Components
 	----------------------------------------------------*/
@@ -310,6 +405,14 @@ private:
 	UPROPERTY(Replicated)
 	ENovaTimeDilation ServerTimeDilation;
 
+	// Replicated fast forward rate in simulated minutes per second, zero outside of fast forward
+	UPROPERTY(ReplicatedUsing = OnFastForwardReplicated)
+	float ServerFastForwardRate;
+
+	// Replicated fast forward progress towards the next event
+	UPROPERTY(Replicated)
+	float ServerFastForwardProgress;
+
 	// Current state
 	int32 CurrentPriceRotation;
 
@@ -319,11 +422,34 @@ private:
 	bool   IsFastForward;
 	float  TimeSinceLastFastForward;
 
+	// Fixed-rate simulation state
+	float     SimulationTimeAccumulator;
+	FNovaTime PreviousSimulationTime;
+
+	// Fast forward state
+	FNovaTime FastForwardStartTime;
+	double    FastForwardUpdateCost;
+	double    ClientFastForwardStartTime;
+
 	// Event observation system
 	float                          TimeSinceEvent;
 	TArray<FNovaTime>              TimeJumpEvents;
 	TArray<const class UNovaArea*> AreaChangeEvents;
 
+	// Dedicated server reporting state
+	float TimeSinceServerReport;
+	int32 FramesSinceServerReport;
+
+	// Spacecraft pawn registry
+	TArray<class ANovaSpacecraftPawn*>      SpacecraftPawns;
+	TMap<class ANovaSpacecraftPawn*, FGuid> SpacecraftPawnIdentifiers;
+	TMap<FGuid, class ANovaSpacecraftPawn*> SpacecraftPawnIndex;
+	TMap<FGuid, class ANovaPlayerState*>    SpacecraftPlayerStateIndex;
+
+	// Spacecraft system registry, indexed by owning pawn
+	TArray<class INovaSpacecraftSystemInterface*>                          SpacecraftSystems;
+	TMap<const class ANovaSpacecraftPawn*, TArray<class UActorComponent*>> SpacecraftSystemIndex;
+
 public:
 	/*----------------------------------------------------
 	    Getters
@@ -39,6 +39,15 @@ enum class ENovaSerialize : uint8
 	DataToJson
 };
 
+/** Independently serialized parts of a game save */
+enum class ENovaSaveSection : uint8
+{
+	Player,
+	GameState,
+	ContractManager,
+	Count
+};
+
 /*----------------------------------------------------
     Currency type
 ----------------------------------------------------*/
@@ -272,6 +281,12 @@ struct FNovaTime
 		return T;
 	}
 
+	friend FArchive& operator<<(FArchive& Ar, FNovaTime& Time)
+	{
+		Ar << Time.Minutes;
+		return Ar;
+	}
+
 	UPROPERTY()
 	double Minutes;
 };
@@ -16,6 +16,16 @@
 
 #define LOCTEXT_NAMESPACE "UNovaOrbitalSimulationComponent"
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spacecraft entries at full rate"), STAT_NovaSpacecraftFullRate, STATGROUP_Nova);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spacecraft entries at reduced rate"), STAT_NovaSpacecraftReducedRate, STATGROUP_Nova);
+
+/*----------------------------------------------------
+    Definitions
+----------------------------------------------------*/
+
+// Simulation
+static constexpr int32 MinParallelLocationUpdates = 64;
+
 /*----------------------------------------------------
     Internal structures
 ----------------------------------------------------*/
@@ -59,36 +69,8 @@ struct FNovaSpacecraftFleetManeuver
 /** Structure representing a fleet of spacecraft */
 struct FNovaSpacecraftFleet
 {
-	struct FNovaSpacecraftFleetEntry
-	{
-		FNovaSpacecraftFleetEntry(const FNovaSpacecraft* Spacecraft, const ANovaGameState* GameState)
-		{
-			Metrics = Spacecraft->GetPropulsionMetrics();
-
-			UNovaSpacecraftPropellantSystem* PropellantSystem = GameState->GetSpacecraftSystem<UNovaSpacecraftPropellantSystem>(Spacecraft);
-
-			// The core assumption here is that only maneuvers can modify mass, and so the current mass won't change until the next
-			// maneuver. The practical consequence is that trajectories can only ever be plotted while undocked
-			// and any non-propulsion-related transfer of mass should abort the trajectory
-			CurrentCargoMass = Spacecraft->GetCurrentCargoMass();
-			CurrentPropellantMass =
-				PropellantSystem ? PropellantSystem->GetCurrentPropellantMass() : Spacecraft->GetPropulsionMetrics().PropellantMassCapacity;
-		}
-
-		FNovaSpacecraftPropulsionMetrics Metrics;
-		float                            CurrentCargoMass;
-		float                            CurrentPropellantMass;
-	};
-
-	FNovaSpacecraftFleet(const TArray<FGuid>& SpacecraftIdentifiers, const ANovaGameState* GameState)
-	{
-		for (const FGuid& Identifier : SpacecraftIdentifiers)
-		{
-			const FNovaSpacecraft* NewSpacecraft = GameState->GetSpacecraft(Identifier);
-			NCHECK(NewSpacecraft != nullptr);
-			Fleet.Add(FNovaSpacecraftFleetEntry(NewSpacecraft, GameState));
-		}
-	}
+	FNovaSpacecraftFleet(const TArray<FNovaSpacecraftFleetEntry>& Entries) : Fleet(Entries)
+	{}
 
 	FNovaSpacecraftFleetManeuver AddManeuver(double DeltaV)
 	{
@@ -120,6 +102,21 @@ struct FNovaSpacecraftFleet
 	TArray<FNovaSpacecraftFleetEntry> Fleet;
 };
 
+FNovaSpacecraftFleetEntry::FNovaSpacecraftFleetEntry(const FNovaSpacecraft* Spacecraft, const ANovaGameState* GameState)
+{
+	Metrics = Spacecraft->GetPropulsionMetrics();
+
+	UNovaSpacecraftPropellantSystem* PropellantSystem =
+		GameState ? GameState->GetSpacecraftSystem<UNovaSpacecraftPropellantSystem>(Spacecraft) : nullptr;
+
+	// The core assumption here is that only maneuvers can modify mass, and so the current mass won't change until the next
+	// maneuver. The practical consequence is that trajectories can only ever be plotted while undocked
+	// and any non-propulsion-related transfer of mass should abort the trajectory
+	CurrentCargoMass = Spacecraft->GetCurrentCargoMass();
+	CurrentPropellantMass =
+		PropellantSystem ? PropellantSystem->GetCurrentPropellantMass() : Spacecraft->GetPropulsionMetrics().PropellantMassCapacity;
+}
+
 /*----------------------------------------------------
     Constructor
 ----------------------------------------------------*/
@@ -131,6 +128,8 @@ UNovaOrbitalSimulationComponent::UNovaOrbitalSimulationComponent() : Super()
 
 	// Defaults
 	OrbitGarbageCollectionDelay = 1.0f;
+	SpacecraftLODDistance       = 2000;
+	SpacecraftLODUpdatePeriod   = 0.1f;
 }
 
 /*----------------------------------------------------
@@ -152,6 +151,7 @@ void UNovaOrbitalSimulationComponent::UpdateSimulation()
 	SpacecraftTrajectoryDatabase.UpdateCache();
 
 	// Run processes
+	ProcessSimulationLOD();
 	ProcessOrbitCleanup();
 	ProcessAreas();
 	ProcessAsteroids();
@@ -170,6 +170,22 @@ FNovaTime UNovaOrbitalSimulationComponent::GetCurrentTime() const
 
 FNovaTrajectoryParameters UNovaOrbitalSimulationComponent::PrepareTrajectory(
 	const FNovaOrbit& Source, const FNovaOrbit& Destination, FNovaTime DeltaTime, const TArray<FGuid>& SpacecraftIdentifiers) const
+{
+	// Capture the current propulsion state of the fleet
+	const ANovaGameState*             GameState = GetOwner<ANovaGameState>();
+	TArray<FNovaSpacecraftFleetEntry> Fleet;
+	for (const FGuid& Identifier : SpacecraftIdentifiers)
+	{
+		const FNovaSpacecraft* Spacecraft = GameState->GetSpacecraft(Identifier);
+		NCHECK(Spacecraft != nullptr);
+		Fleet.Add(FNovaSpacecraftFleetEntry(Spacecraft, GameState));
+	}
+
+	return PrepareTrajectory(Source, Destination, DeltaTime, SpacecraftIdentifiers, Fleet);
+}
+
+FNovaTrajectoryParameters UNovaOrbitalSimulationComponent::PrepareTrajectory(const FNovaOrbit& Source, const FNovaOrbit& Destination,
+	FNovaTime DeltaTime, const TArray<FGuid>& SpacecraftIdentifiers, const TArray<FNovaSpacecraftFleetEntry>& Fleet) const
 {
 	FNovaTrajectoryParameters Parameters;
 
@@ -178,6 +194,7 @@ FNovaTrajectoryParameters UNovaOrbitalSimulationComponent::PrepareTrajectory(
 	NCHECK(Destination.Geometry.IsCircular());
 	NCHECK(Source.Geometry.Body == Destination.Geometry.Body);
 	NCHECK(SpacecraftIdentifiers.Num() > 0);
+	NCHECK(SpacecraftIdentifiers.Num() == Fleet.Num());
 
 	// Get basic parameters
 	Parameters.StartTime             = GetCurrentTime() + DeltaTime;
@@ -190,6 +207,9 @@ FNovaTrajectoryParameters UNovaOrbitalSimulationComponent::PrepareTrajectory(
 	Parameters.Body = Source.Geometry.Body;
 	Parameters.µ    = Source.Geometry.Body->GetGravitationalParameter();
 
+	// Get propulsion parameters
+	Parameters.Fleet = Fleet;
+
 	return Parameters;
 }
 
@@ -261,7 +281,7 @@ FNovaTrajectory UNovaOrbitalSimulationComponent::ComputeTrajectory(const FNovaTr
 	const FNovaTime TotalTravelDuration = TotalTransferDuration + PhasingDuration;
 
 	// Start building trajectory
-	FNovaSpacecraftFleet Fleet(Parameters.SpacecraftIdentifiers, Cast<ANovaGameState>(GetOwner()));
+	FNovaSpacecraftFleet Fleet(Parameters.Fleet);
 	FNovaTrajectory      Trajectory;
 	Trajectory.InitialOrbit = Parameters.Source;
 	FNovaTime CurrentTime   = StartTime + InitialWaitingDuration;
@@ -554,6 +574,31 @@ void UNovaOrbitalSimulationComponent::MergeOrbit(const TArray<FGuid>& Spacecraft
 	SetOrbit(SpacecraftIdentifiers, Orbit);
 }
 
+void UNovaOrbitalSimulationComponent::SplitOrbit(const TArray<FGuid>& SpacecraftIdentifiers)
+{
+	NCHECK(GetOwner()->GetLocalRole() == ROLE_Authority);
+
+	NLOG("UNovaOrbitalSimulationComponent::SplitOrbit for %d spacecraft", SpacecraftIdentifiers.Num());
+
+	for (const FGuid& Identifier : SpacecraftIdentifiers)
+	{
+		SpacecraftOrbitDatabase.Split(Identifier);
+	}
+}
+
+void UNovaOrbitalSimulationComponent::RemoveSpacecraft(const FGuid& Identifier)
+{
+	NCHECK(GetOwner()->GetLocalRole() == ROLE_Authority);
+	NCHECK(SpacecraftTrajectoryDatabase.GetFleetSize(Identifier) <= 1);
+
+	NLOG("UNovaOrbitalSimulationComponent::RemoveSpacecraft");
+
+	// Trajectories can't be split since maneuvers hold per-spacecraft data, but orbits can
+	SpacecraftOrbitDatabase.Split(Identifier);
+	SpacecraftOrbitDatabase.Remove({Identifier});
+	SpacecraftTrajectoryDatabase.Remove({Identifier});
+}
+
 /*----------------------------------------------------
     Trajectory & orbiting getters
 ----------------------------------------------------*/
@@ -656,6 +701,41 @@ const FNovaOrbitalLocation* UNovaOrbitalSimulationComponent::GetPlayerLocation()
 	}
 }
 
+FNovaOrbitalLocation UNovaOrbitalSimulationComponent::GetSpacecraftLocationAtTime(const FGuid& Identifier, FNovaTime Time) const
+{
+	const FNovaTrajectory* Trajectory = GetSpacecraftTrajectory(Identifier);
+	const FNovaOrbit*      Orbit      = GetSpacecraftOrbit(Identifier);
+
+	if (Trajectory && Time >= Trajectory->GetFirstManeuverStartTime())
+	{
+		return Trajectory->GetLocation(Time);
+	}
+	else if (Orbit)
+	{
+		return Orbit->GetLocation(Time);
+	}
+	else
+	{
+		const FNovaOrbitalLocation* Location = GetSpacecraftLocation(Identifier);
+		return Location ? *Location : FNovaOrbitalLocation();
+	}
+}
+
+FNovaOrbitalLocation UNovaOrbitalSimulationComponent::GetPlayerLocationAtTime(FNovaTime Time) const
+{
+	const ANovaGameState* GameState        = GetOwner<ANovaGameState>();
+	const FGuid&          PlayerIdentifier = GameState->GetPlayerSpacecraftIdentifier();
+
+	if (PlayerIdentifier.IsValid())
+	{
+		return GetSpacecraftLocationAtTime(PlayerIdentifier, Time);
+	}
+	else
+	{
+		return FNovaOrbitalLocation();
+	}
+}
+
 TPair<const UNovaArea*, double> UNovaOrbitalSimulationComponent::GetNearestAreaAndDistance(const FNovaOrbitalLocation& Location) const
 {
 	const UNovaArea* ClosestArea     = nullptr;
@@ -728,6 +808,65 @@ float UNovaOrbitalSimulationComponent::GetCurrentSpacecraftThrustFactor(const FG
     Internals
 ----------------------------------------------------*/
 
+void UNovaOrbitalSimulationComponent::ProcessSimulationLOD()
+{
+	const ANovaGameState* GameState = GetOwner<ANovaGameState>();
+
+	// Get the player locations from the last update
+	PlayerCartesianLocations.Reset();
+	for (const FGuid& Identifier : GameState->GetPlayerSpacecraftIdentifiers())
+	{
+		const FNovaCartesianLocation* Location = SpacecraftCartesianLocations.Find(Identifier);
+		if (Location)
+		{
+			PlayerCartesianLocations.Add(Location->Location);
+		}
+	}
+}
+
+bool UNovaOrbitalSimulationComponent::IsSpacecraftLocationRelevant(const TArray<FGuid>& Identifiers, FNovaTime CurrentTime) const
+{
+	if (SpacecraftLODUpdatePeriod <= 0 || Identifiers.Num() == 0)
+	{
+		INC_DWORD_STAT(STAT_NovaSpacecraftFullRate);
+		return true;
+	}
+
+	// Entries near any player, or not computed yet, are always updated
+	for (const FGuid& Identifier : Identifiers)
+	{
+		const FNovaCartesianLocation* Location = SpacecraftCartesianLocations.Find(Identifier);
+		if (Location == nullptr)
+		{
+			INC_DWORD_STAT(STAT_NovaSpacecraftFullRate);
+			return true;
+		}
+
+		for (const FVector2D& PlayerLocation : PlayerCartesianLocations)
+		{
+			if (FVector2D::Distance(Location->Location, PlayerLocation) < SpacecraftLODDistance)
+			{
+				INC_DWORD_STAT(STAT_NovaSpacecraftFullRate);
+				return true;
+			}
+		}
+	}
+
+	// Distant entries are updated once per period of game time, with a stable per-entry phase to spread the updates
+	const FNovaCartesianLocation& Location = SpacecraftCartesianLocations[Identifiers[0]];
+	const double                  Phase    = (GetTypeHash(Identifiers[0]) % 1024) / 1024.0;
+	const double                  Current  = FMath::FloorToDouble(CurrentTime.AsMinutes() / SpacecraftLODUpdatePeriod + Phase);
+	const double                  Previous = FMath::FloorToDouble(Location.UpdateTime.AsMinutes() / SpacecraftLODUpdatePeriod + Phase);
+	if (Current != Previous)
+	{
+		INC_DWORD_STAT(STAT_NovaSpacecraftFullRate);
+		return true;
+	}
+
+	INC_DWORD_STAT(STAT_NovaSpacecraftReducedRate);
+	return false;
+}
+
 void UNovaOrbitalSimulationComponent::ProcessOrbitCleanup()
 {
 	if (GetOwner()->GetLocalRole() == ROLE_Authority)
@@ -741,6 +880,16 @@ void UNovaOrbitalSimulationComponent::ProcessOrbitCleanup()
 			}
 		}
 	}
+
+	// Forget the location of spacecraft that were removed from the simulation
+	for (auto Iterator = SpacecraftOrbitalLocations.CreateIterator(); Iterator; ++Iterator)
+	{
+		if (SpacecraftOrbitDatabase.Get(Iterator.Key()) == nullptr && SpacecraftTrajectoryDatabase.Get(Iterator.Key()) == nullptr)
+		{
+			SpacecraftCartesianLocations.Remove(Iterator.Key());
+			Iterator.RemoveCurrent();
+		}
+	}
 }
 
 void UNovaOrbitalSimulationComponent::ProcessAreas()
@@ -792,100 +941,115 @@ void UNovaOrbitalSimulationComponent::ProcessAsteroids()
 
 void UNovaOrbitalSimulationComponent::ProcessSpacecraftOrbits()
 {
-	for (const FNovaOrbitDatabaseEntry& DatabaseEntry : SpacecraftOrbitDatabase.Get())
+	const TArray<FNovaOrbitDatabaseEntry>& DatabaseEntries = SpacecraftOrbitDatabase.Get();
+	const FNovaTime                        CurrentTime     = GetCurrentTime();
+
+	// Select the entries to update
+	TArray<int32> UpdatedEntries;
+	for (int32 EntryIndex = 0; EntryIndex < DatabaseEntries.Num(); EntryIndex++)
 	{
-		// Update the position
-		const FNovaOrbitalLocation NewLocation = DatabaseEntry.Orbit.GetLocation(GetCurrentTime());
-		FNovaCartesianLocation     NewCartesianLocation;
-		NewCartesianLocation.Location = NewLocation.GetCartesianLocation();
-		NewCartesianLocation.Velocity = NewLocation.GetOrbitalVelocity();
+		if (IsSpacecraftLocationRelevant(DatabaseEntries[EntryIndex].Identifiers, CurrentTime))
+		{
+			UpdatedEntries.Add(EntryIndex);
+		}
+	}
+
+	// Compute the new positions in parallel, as this only reads orbits
+	TArray<FNovaOrbitalLocation>   NewLocations;
+	TArray<FNovaCartesianLocation> NewCartesianLocations;
+	NewLocations.SetNum(UpdatedEntries.Num());
+	NewCartesianLocations.SetNum(UpdatedEntries.Num());
+	ParallelFor(
+		UpdatedEntries.Num(),
+		[&](int32 Index)
+		{
+			const FNovaOrbitalLocation NewLocation = DatabaseEntries[UpdatedEntries[Index]].Orbit.GetLocation(CurrentTime);
+
+			NewLocations[Index]                     = NewLocation;
+			NewCartesianLocations[Index].Location   = NewLocation.GetCartesianLocation();
+			NewCartesianLocations[Index].Velocity   = NewLocation.GetOrbitalVelocity();
+			NewCartesianLocations[Index].UpdateTime = CurrentTime;
+		},
+		GetSimulationParallelForFlags(UpdatedEntries.Num(), MinParallelLocationUpdates));
+
+	// Add or update the current orbit and position
+	for (int32 Index = 0; Index < UpdatedEntries.Num(); Index++)
+	{
+		const FNovaOrbitDatabaseEntry& DatabaseEntry = DatabaseEntries[UpdatedEntries[Index]];
 
 #if 0
 		NLOG("UNovaOrbitalSimulationComponent::ProcessSpacecraftOrbits : %s has phase %f, sphase %f, ephase %f",
-			*DatabaseEntry.Identifiers[0].ToString(), NewLocation.Phase, NewLocation.Geometry.StartPhase, NewLocation.Geometry.EndPhase);
+			*DatabaseEntry.Identifiers[0].ToString(), NewLocations[Index].Phase, NewLocations[Index].Geometry.StartPhase,
+			NewLocations[Index].Geometry.EndPhase);
 #endif
 
-		// Add or update the current orbit and position
-		for (const FGuid& Identifier : DatabaseEntry.Identifiers)
-		{
-			FNovaOrbitalLocation* Entry = SpacecraftOrbitalLocations.Find(Identifier);
-			if (Entry)
-			{
-				*Entry = NewLocation;
-			}
-			else
-			{
-				SpacecraftOrbitalLocations.Add(Identifier, NewLocation);
-			}
-
-			FNovaCartesianLocation* CartesianEntry = SpacecraftCartesianLocations.Find(Identifier);
-			if (CartesianEntry)
-			{
-				*CartesianEntry = NewCartesianLocation;
-			}
-			else
-			{
-				SpacecraftCartesianLocations.Add(Identifier, NewCartesianLocation);
-			}
-		}
+		SetSpacecraftLocation(DatabaseEntry.Identifiers, NewLocations[Index], NewCartesianLocations[Index]);
 	}
 }
 
 void UNovaOrbitalSimulationComponent::ProcessSpacecraftTrajectories()
 {
-	TArray<TArray<FGuid>> CompletedTrajectories;
+	const TArray<FNovaTrajectoryDatabaseEntry>& DatabaseEntries = SpacecraftTrajectoryDatabase.Get();
+	const FNovaTime                             CurrentTime     = GetCurrentTime();
+	TArray<TArray<FGuid>>                       CompletedTrajectories;
 
-	for (const FNovaTrajectoryDatabaseEntry& DatabaseEntry : SpacecraftTrajectoryDatabase.Get())
+	// Select the entries to update
+	TArray<int32> UpdatedEntries;
+	for (int32 EntryIndex = 0; EntryIndex < DatabaseEntries.Num(); EntryIndex++)
 	{
-		if (GetCurrentTime() >= DatabaseEntry.Trajectory.GetFirstManeuverStartTime())
+		const FNovaTrajectoryDatabaseEntry& DatabaseEntry = DatabaseEntries[EntryIndex];
+
+		// Entries that arrived are always evaluated so that they complete at their final location
+		const bool HasArrived = CurrentTime >= DatabaseEntry.Trajectory.GetArrivalTime();
+		if (CurrentTime >= DatabaseEntry.Trajectory.GetFirstManeuverStartTime() &&
+			(HasArrived || IsSpacecraftLocationRelevant(DatabaseEntry.Identifiers, CurrentTime)))
 		{
-			// Compute the new location
-			FNovaOrbitalLocation NewLocation = DatabaseEntry.Trajectory.GetLocation(GetCurrentTime());
-			if (!NewLocation.IsValid())
-			{
-				NLOG("UNovaOrbitalSimulationComponent::ProcessSpacecraftTrajectories : missing trajectory data");
-			}
+			UpdatedEntries.Add(EntryIndex);
+		}
+	}
 
-			// Precompute Cartesian and velocity
-			FNovaCartesianLocation NewCartesianLocation;
-			NewCartesianLocation.Location = DatabaseEntry.Trajectory.GetCartesianLocation(GetCurrentTime());
-			NewCartesianLocation.Velocity = NewLocation.GetOrbitalVelocity();
+	// Evaluate trajectories in parallel, as this only reads trajectories
+	TArray<FNovaOrbitalLocation>   NewLocations;
+	TArray<FNovaCartesianLocation> NewCartesianLocations;
+	NewLocations.SetNum(UpdatedEntries.Num());
+	NewCartesianLocations.SetNum(UpdatedEntries.Num());
+	ParallelFor(
+		UpdatedEntries.Num(),
+		[&](int32 Index)
+		{
+			const FNovaTrajectory& Trajectory = DatabaseEntries[UpdatedEntries[Index]].Trajectory;
+
+			NewLocations[Index]                     = Trajectory.GetLocation(CurrentTime);
+			NewCartesianLocations[Index].Location   = Trajectory.GetCartesianLocation(CurrentTime);
+			NewCartesianLocations[Index].Velocity   = NewLocations[Index].GetOrbitalVelocity();
+			NewCartesianLocations[Index].UpdateTime = CurrentTime;
+		},
+		GetSimulationParallelForFlags(UpdatedEntries.Num(), MinParallelLocationUpdates));
+
+	// Add or update the current orbit and location
+	for (int32 Index = 0; Index < UpdatedEntries.Num(); Index++)
+	{
+		const FNovaTrajectoryDatabaseEntry& DatabaseEntry = DatabaseEntries[UpdatedEntries[Index]];
+		if (!NewLocations[Index].IsValid())
+		{
+			NLOG("UNovaOrbitalSimulationComponent::ProcessSpacecraftTrajectories : missing trajectory data");
+		}
 
 #if 0
-			NLOG("UNovaOrbitalSimulationComponent::ProcessSpacecraftTrajectories : %s has phase %f, with sphase %f, ephase %f",
-				*DatabaseEntry.Identifiers[0].ToString(), NewLocation.Phase, NewLocation.Geometry.StartPhase,
-				NewLocation.Geometry.EndPhase);
+		NLOG("UNovaOrbitalSimulationComponent::ProcessSpacecraftTrajectories : %s has phase %f, with sphase %f, ephase %f",
+			*DatabaseEntry.Identifiers[0].ToString(), NewLocations[Index].Phase, NewLocations[Index].Geometry.StartPhase,
+			NewLocations[Index].Geometry.EndPhase);
 #endif
 
-			// Add or update the current orbit and location
-			for (const FGuid& Identifier : DatabaseEntry.Identifiers)
-			{
-				FNovaOrbitalLocation* Entry = SpacecraftOrbitalLocations.Find(Identifier);
-				if (Entry)
-				{
-					*Entry = NewLocation;
-				}
-				else
-				{
-					SpacecraftOrbitalLocations.Add(Identifier, NewLocation);
-				}
-
-				FNovaCartesianLocation* CartesianEntry = SpacecraftCartesianLocations.Find(Identifier);
-				if (CartesianEntry)
-				{
-					*CartesianEntry = NewCartesianLocation;
-				}
-				else
-				{
-					SpacecraftCartesianLocations.Add(Identifier, NewCartesianLocation);
-				}
-			}
+		SetSpacecraftLocation(DatabaseEntry.Identifiers, NewLocations[Index], NewCartesianLocations[Index]);
+	}
 
-			// Complete the trajectory on arrival
-			if (GetCurrentTime() > DatabaseEntry.Trajectory.GetArrivalTime())
-			{
-				CompletedTrajectories.Add(DatabaseEntry.Identifiers);
-			}
+	for (const FNovaTrajectoryDatabaseEntry& DatabaseEntry : DatabaseEntries)
+	{
+		// Complete the trajectory on arrival, regardless of the update rate
+		if (GetCurrentTime() > DatabaseEntry.Trajectory.GetArrivalTime())
+		{
+			CompletedTrajectories.Add(DatabaseEntry.Identifiers);
 		}
 
 		// If this trajectory is for a player spacecraft, detect whether we're nearing a maneuver
@@ -909,6 +1073,33 @@ void UNovaOrbitalSimulationComponent::ProcessSpacecraftTrajectories()
 	}
 }
 
+void UNovaOrbitalSimulationComponent::SetSpacecraftLocation(
+	const TArray<FGuid>& Identifiers, const FNovaOrbitalLocation& Location, const FNovaCartesianLocation& CartesianLocation)
+{
+	for (const FGuid& Identifier : Identifiers)
+	{
+		FNovaOrbitalLocation* Entry = SpacecraftOrbitalLocations.Find(Identifier);
+		if (Entry)
+		{
+			*Entry = Location;
+		}
+		else
+		{
+			SpacecraftOrbitalLocations.Add(Identifier, Location);
+		}
+
+		FNovaCartesianLocation* CartesianEntry = SpacecraftCartesianLocations.Find(Identifier);
+		if (CartesianEntry)
+		{
+			*CartesianEntry = CartesianLocation;
+		}
+		else
+		{
+			SpacecraftCartesianLocations.Add(Identifier, CartesianLocation);
+		}
+	}
+}
+
 /*----------------------------------------------------
     Networking
 ----------------------------------------------------*/
@@ -19,9 +19,21 @@ struct FNovaCartesianLocation
 {
 	FVector2D Location;
 	FVector2D Velocity;
+	FNovaTime UpdateTime;
 };
 
-/** Trajectory computation parameters */
+/** Propulsion state of a spacecraft at the time a trajectory is prepared */
+struct FNovaSpacecraftFleetEntry
+{
+	/** Capture a spacecraft, with full propellant if the game state isn't provided */
+	FNovaSpacecraftFleetEntry(const FNovaSpacecraft* Spacecraft, const class ANovaGameState* GameState = nullptr);
+
+	FNovaSpacecraftPropulsionMetrics Metrics;
+	float                            CurrentCargoMass;
+	float                            CurrentPropellantMass;
+};
+
+/** Trajectory computation parameters, self-contained so that trajectories can be computed outside of the game thread */
 struct FNovaTrajectoryParameters
 {
 	FNovaTime     StartTime;
@@ -32,6 +44,8 @@ struct FNovaTrajectoryParameters
 
 	const UNovaCelestialBody* Body;
 	double                    µ;
+
+	TArray<FNovaSpacecraftFleetEntry> Fleet;
 };
 
 /** Orbital simulation component that ticks orbiting spacecraft */
@@ -70,8 +84,12 @@ public:
 	FNovaTrajectoryParameters PrepareTrajectory(
 		const FNovaOrbit& Source, const FNovaOrbit& Destination, FNovaTime DeltaTime, const TArray<FGuid>& SpacecraftIdentifiers) const;
 
-	/** Compute a trajectory */
-	FNovaTrajectory ComputeTrajectory(const FNovaTrajectoryParameters& Parameters, float PhasingAltitude);
+	/** Build trajectory parameters from an arbitrary orbit to another, for spacecraft that aren't in the game state */
+	FNovaTrajectoryParameters PrepareTrajectory(const FNovaOrbit& Source, const FNovaOrbit& Destination, FNovaTime DeltaTime,
+		const TArray<FGuid>& SpacecraftIdentifiers, const TArray<FNovaSpacecraftFleetEntry>& Fleet) const;
+
+	/** Compute a trajectory, only relying on the parameters so that this is safe to run on any thread */
+	static FNovaTrajectory ComputeTrajectory(const FNovaTrajectoryParameters& Parameters, float PhasingAltitude);
 
 	/** Check if this spacecraft is on a trajectory */
 	bool IsOnTrajectory(const FGuid& SpacecraftIdentifier) const;
@@ -97,6 +115,12 @@ public:
 	/** Merge different spacecraft in a particular orbit */
 	void MergeOrbit(const TArray<FGuid>& SpacecraftIdentifiers, const FNovaOrbit& Orbit);
 
+	/** Give spacecraft sharing an orbit with others their own orbit entry */
+	void SplitOrbit(const TArray<FGuid>& SpacecraftIdentifiers);
+
+	/** Remove a spacecraft from the simulation */
+	void RemoveSpacecraft(const FGuid& Identifier);
+
 	/*----------------------------------------------------
 	    Simple trajectory & orbiting getters
 	----------------------------------------------------*/
@@ -158,6 +182,12 @@ public:
 		return SpacecraftTrajectoryDatabase.GetSpacecraftIndex(Identifier);
 	}
 
+	/** Get the amount of spacecraft sharing a spacecraft's trajectory */
+	int32 GetSpacecraftTrajectoryFleetSize(const FGuid& Identifier) const
+	{
+		return SpacecraftTrajectoryDatabase.GetFleetSize(Identifier);
+	}
+
 	/** Get a player spacecraft's index in a trajectory */
 	int32 GetPlayerSpacecraftIndex(const FGuid& Identifier) const;
 
@@ -221,6 +251,12 @@ public:
 	/** Get the player location */
 	const FNovaOrbitalLocation* GetPlayerLocation() const;
 
+	/** Get a spacecraft's location evaluated at an arbitrary time from its trajectory or orbit, for presentation */
+	FNovaOrbitalLocation GetSpacecraftLocationAtTime(const FGuid& Identifier, FNovaTime Time) const;
+
+	/** Get the player location evaluated at an arbitrary time from its trajectory or orbit, for presentation */
+	FNovaOrbitalLocation GetPlayerLocationAtTime(FNovaTime Time) const;
+
 	/** Get the time left until a trajectory starts */
 	FNovaTime GetTimeLeftUntilPlayerTrajectoryStart(FNovaTime TimeMargin = FNovaTime()) const
 	{
@@ -265,6 +301,12 @@ public:
 	----------------------------------------------------*/
 
 protected:
+	/** Prepare the level of detail for spacecraft updates */
+	void ProcessSimulationLOD();
+
+	/** Check whether a spacecraft database entry needs its location updated this time */
+	bool IsSpacecraftLocationRelevant(const TArray<FGuid>& Identifiers, FNovaTime CurrentTime) const;
+
 	/** Clean up obsolete orbit data */
 	void ProcessOrbitCleanup();
 
@@ -280,6 +322,10 @@ protected:
 	/** Update the current trajectory of spacecraft */
 	void ProcessSpacecraftTrajectories();
 
+	/** Store the computed location of a group of spacecraft */
+	void SetSpacecraftLocation(
+		const TArray<FGuid>& Identifiers, const FNovaOrbitalLocation& Location, const FNovaCartesianLocation& CartesianLocation);
+
 	/** Compute the period of a stable circular orbit */
 	static FNovaTime GetOrbitalPeriod(const double GravitationalParameter, const double SemiMajorAxis)
 	{
@@ -295,6 +341,14 @@ public:
 	UPROPERTY(Category = Nova, EditDefaultsOnly)
 	float OrbitGarbageCollectionDelay;
 
+	// Distance in kilometers from all players over which spacecraft locations are updated at a reduced rate
+	UPROPERTY(Category = Nova, EditDefaultsOnly)
+	float SpacecraftLODDistance;
+
+	// Game time in minutes between two location updates for distant spacecraft
+	UPROPERTY(Category = Nova, EditDefaultsOnly)
+	float SpacecraftLODUpdatePeriod;
+
 	/*----------------------------------------------------
 	    Data
 	----------------------------------------------------*/
@@ -313,6 +367,9 @@ private:
 	TMap<FGuid, FNovaOrbitalLocation>                  SpacecraftOrbitalLocations;
 	TMap<FGuid, FNovaCartesianLocation>                SpacecraftCartesianLocations;
 
+	// Level of detail
+	TArray<FVector2D> PlayerCartesianLocations;
+
 	// General state
 	FNovaTime                      TimeOfNextPlayerManeuver;
 	TArray<const class UNovaArea*> Areas;
@@ -76,7 +76,8 @@ struct TGuidCacheMap
 	/** Update the map from the array Array */
 	void Update(const TArray<T>& Array)
 	{
-		TArray<FGuid> KnownIdentifiers;
+		TSet<FGuid> KnownIdentifiers;
+		KnownIdentifiers.Reserve(Array.Num());
 
 		// Database insertion and update
 		int32 Index = 0;
@@ -214,7 +215,8 @@ struct TMultiGuidCacheMap
 	/** Update the map from the array Array */
 	void Update(const TArray<T>& Array)
 	{
-		TArray<FGuid> KnownIdentifiers;
+		TSet<FGuid> KnownIdentifiers;
+		KnownIdentifiers.Reserve(Map.Num());
 
 		// Database insertion and update
 		int32 Index = 0;
@@ -274,7 +276,10 @@ struct FNovaSpacecraftDatabase : public FFastArraySerializer
 
 	bool Add(const FNovaSpacecraft& Spacecraft)
 	{
-		return Cache.Add(*this, Array, Spacecraft);
+		FNovaSpacecraft ModifiedSpacecraft = Spacecraft;
+		ModifiedSpacecraft.MarkModified();
+
+		return Cache.Add(*this, Array, ModifiedSpacecraft);
 	}
 
 	void Remove(const FGuid& Identifier)
@@ -363,6 +368,22 @@ struct FNovaOrbitDatabase : public FFastArraySerializer
 		Cache.Remove(*this, Array, SpacecraftIdentifiers);
 	}
 
+	/** Move a spacecraft out of a shared entry into its own entry */
+	void Split(const FGuid& Identifier)
+	{
+		const FNovaOrbitDatabaseEntry* Entry = Cache.Get(Identifier, Array);
+		if (Entry && Entry->Identifiers.Num() > 1)
+		{
+			const FNovaOrbit Orbit                = Entry->Orbit;
+			TArray<FGuid>    RemainingIdentifiers = Entry->Identifiers;
+			RemainingIdentifiers.Remove(Identifier);
+
+			Remove({Identifier});
+			Add(RemainingIdentifiers, Orbit);
+			Add({Identifier}, Orbit);
+		}
+	}
+
 	const FNovaOrbit* Get(const FGuid& Identifier) const
 	{
 		const FNovaOrbitDatabaseEntry* Entry = Cache.Get(Identifier, Array);
@@ -468,6 +489,12 @@ struct FNovaTrajectoryDatabase : public FFastArraySerializer
 		return INDEX_NONE;
 	}
 
+	int32 GetFleetSize(const FGuid& Identifier) const
+	{
+		const FNovaTrajectoryDatabaseEntry* Entry = Cache.Get(Identifier, Array);
+		return Entry ? Entry->Identifiers.Num() : 0;
+	}
+
 	void UpdateCache()
 	{
 		Cache.Update(Array);
@@ -157,3 +157,17 @@ TArray<FNovaOrbit> FNovaTrajectory::GetRelevantOrbitsForManeuver(const FNovaMane
 
 	return Result;
 }
+
+FNovaTrajectory FNovaTrajectory::GetSingleSpacecraftTrajectory(int32 SpacecraftIndex) const
+{
+	FNovaTrajectory Result = *this;
+
+	for (FNovaManeuver& Maneuver : Result.Maneuvers)
+	{
+		// Default to full thrust when the index is unknown
+		const float ThrustFactor = Maneuver.ThrustFactors.IsValidIndex(SpacecraftIndex) ? Maneuver.ThrustFactors[SpacecraftIndex] : 1.0f;
+		Maneuver.ThrustFactors   = {ThrustFactor};
+	}
+
+	return Result;
+}
@@ -167,6 +167,16 @@ struct FNovaOrbitGeometry
 		return Result;
 	}
 
+	friend FArchive& operator<<(FArchive& Ar, FNovaOrbitGeometry& Geometry)
+	{
+		UNovaAssetDescription::SerializeAsset(Ar, Geometry.Body);
+		Ar << Geometry.StartAltitude;
+		Ar << Geometry.OppositeAltitude;
+		Ar << Geometry.StartPhase;
+		Ar << Geometry.EndPhase;
+		return Ar;
+	}
+
 	UPROPERTY()
 	const UNovaCelestialBody* Body;
 
@@ -314,6 +324,13 @@ struct FNovaOrbit
 		return FNovaOrbitalLocation(Geometry, CurrentPhase);
 	}
 
+	friend FArchive& operator<<(FArchive& Ar, FNovaOrbit& Orbit)
+	{
+		Ar << Orbit.Geometry;
+		Ar << Orbit.InsertionTime;
+		return Ar;
+	}
+
 	UPROPERTY()
 	FNovaOrbitGeometry Geometry;
 
@@ -334,6 +351,16 @@ struct FNovaManeuver
 		: DeltaV(DV), Phase(P), Time(T), Duration(D), ThrustFactors(TF)
 	{}
 
+	friend FArchive& operator<<(FArchive& Ar, FNovaManeuver& Maneuver)
+	{
+		Ar << Maneuver.DeltaV;
+		Ar << Maneuver.Phase;
+		Ar << Maneuver.Time;
+		Ar << Maneuver.Duration;
+		Ar << Maneuver.ThrustFactors;
+		return Ar;
+	}
+
 	UPROPERTY()
 	double DeltaV;
 
@@ -536,6 +563,19 @@ struct FNovaTrajectory
 	/** Get the orbits that a maneuver is going from and to */
 	TArray<FNovaOrbit> GetRelevantOrbitsForManeuver(const FNovaManeuver& Maneuver) const;
 
+	/** Get a copy of this fleet trajectory for a single spacecraft, keeping only its own thrust factors */
+	FNovaTrajectory GetSingleSpacecraftTrajectory(int32 SpacecraftIndex) const;
+
+	friend FArchive& operator<<(FArchive& Ar, FNovaTrajectory& Trajectory)
+	{
+		Ar << Trajectory.InitialOrbit;
+		Ar << Trajectory.Transfers;
+		Ar << Trajectory.Maneuvers;
+		Ar << Trajectory.TotalTravelDuration;
+		Ar << Trajectory.TotalDeltaV;
+		return Ar;
+	}
+
 	UPROPERTY()
 	FNovaOrbit InitialOrbit;
 
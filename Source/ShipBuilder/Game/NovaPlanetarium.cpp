@@ -68,6 +68,13 @@ void ANovaPlanetarium::BeginPlay()
 	Super::BeginPlay();
 	NLOG("ANovaPlanetarium::BeginPlay");
 
+	// The planetarium is purely visual
+	if (IsRunningDedicatedServer())
+	{
+		SetActorTickEnabled(false);
+		return;
+	}
+
 	// Check everything
 	NCHECK(SunRotator);
 	NCHECK(Sunlight);
@@ -130,6 +137,10 @@ void ANovaPlanetarium::Tick(float DeltaSeconds)
 
 	if (PlayerLocation)
 	{
+		// Interpolate between simulation steps
+		const FNovaTime PresentationTime        = GameState->GetPresentationTime();
+		const FVector2D PlayerCartesianLocation = OrbitalSimulation->GetPlayerLocationAtTime(PresentationTime).GetCartesianLocation();
+
 		float CurrentSunSkyAngle    = 0;
 		float SunDistanceFromPlanet = 0;
 
@@ -148,12 +159,11 @@ void ANovaPlanetarium::Tick(float DeltaSeconds)
 				if (Body != SunBody)
 				{
 					const double RelativeBodySpinTime =
-						FMath::Fmod(GameState->GetCurrentTime().AsMinutes(), static_cast<double>(Body->RotationPeriod));
+						FMath::Fmod(PresentationTime.AsMinutes(), static_cast<double>(Body->RotationPeriod));
 					const double RelativeBodySpinAngle = 360.0 * (RelativeBodySpinTime / Body->RotationPeriod);
 					const double AbsoluteBodySpinAngle = Body->Phase + RelativeBodySpinAngle;
 
-					const FVector2D PlayerCartesianLocation = PlayerLocation->GetCartesianLocation();
-					const double    OrbitRotationAngle =
+					const double OrbitRotationAngle =
 						FMath::RadiansToDegrees(FVector(PlayerCartesianLocation.X, PlayerCartesianLocation.Y, 0).HeadingAngle());
 
 					// Position
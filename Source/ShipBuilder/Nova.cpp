@@ -12,6 +12,9 @@ DEFINE_LOG_CATEGORY(LogNova)
 
 #define LOCTEXT_NAMESPACE "ShipBuilder"
 
+static TAutoConsoleVariable<int32> CVarParallelSimulation(
+	TEXT("nova.ParallelSimulation"), 1, TEXT("Run read-only simulation phases on worker threads"), ECVF_Default);
+
 /*----------------------------------------------------
     Module loading / unloading code
 ----------------------------------------------------*/
@@ -175,6 +178,43 @@ FText GetPriceText(FNovaCredits Credits)
 	return FText::FromString(FText::AsCurrency(Credits.GetValue(), TEXT("CUR"), &Options).ToString().Replace(TEXT("CUR"), TEXT("Ѥ")));
 }
 
+/*----------------------------------------------------
+    Multithreading tools
+----------------------------------------------------*/
+
+EParallelForFlags GetSimulationParallelForFlags(int32 Count, int32 MinParallelCount)
+{
+	// Small sets cost more to dispatch to workers than to process in place
+	if (Count < MinParallelCount || CVarParallelSimulation.GetValueOnGameThread() == 0)
+	{
+		return EParallelForFlags::ForceSingleThread;
+	}
+
+	return EParallelForFlags::None;
+}
+
+/*----------------------------------------------------
+    Serialization tools
+----------------------------------------------------*/
+
+bool IsSerializedCountValid(FArchive& Ar, int32 Count, int64 MinElementSize, int32 MaxCount)
+{
+	// Archives that can't report their size are only checked against the bounds
+	const int64 TotalSize     = Ar.TotalSize();
+	const int64 Offset        = Ar.Tell();
+	const bool  IsSizeKnown   = TotalSize != INDEX_NONE && Offset != INDEX_NONE;
+	const bool  IsSizeInRange = !IsSizeKnown || Count * MinElementSize <= TotalSize - Offset;
+
+	if (Ar.IsError() || Count < 0 || Count > MaxCount || !IsSizeInRange)
+	{
+		NERR("IsSerializedCountValid : invalid count %d in '%s'", Count, *Ar.GetArchiveName());
+		Ar.SetError();
+		return false;
+	}
+
+	return true;
+}
+
 /*----------------------------------------------------
     Module code
 ----------------------------------------------------*/
@@ -7,6 +7,8 @@
 #include "Runtime/Engine/Classes/Engine/EngineTypes.h"
 #include "Modules/ModuleManager.h"
 #include "Logging/LogMacros.h"
+#include "Stats/Stats.h"
+#include "Async/ParallelFor.h"
 
 /*----------------------------------------------------
     Debugging tools
@@ -14,6 +16,8 @@
 
 DECLARE_LOG_CATEGORY_EXTERN(LogNova, Log, All);
 
+DECLARE_STATS_GROUP(TEXT("Nova"), STATGROUP_Nova, STATCAT_Advanced);
+
 #define NDIS(Format, ...) FNovaModule::DisplayLog(FString::Printf(TEXT(Format), ##__VA_ARGS__))
 #define NLOG(Format, ...) UE_LOG(LogNova, Display, TEXT(Format), ##__VA_ARGS__)
 #define NERR(Format, ...) UE_LOG(LogNova, Error, TEXT(Format), ##__VA_ARGS__)
@@ -32,6 +36,20 @@ FText GetDurationText(struct FNovaTime Time, int32 MaxComponents = 4);
 
 FText GetPriceText(struct FNovaCredits Credits);
 
+/*----------------------------------------------------
+    Multithreading tools
+----------------------------------------------------*/
+
+/** Get the flags for a read-only simulation phase, single-threaded below MinParallelCount items or with nova.ParallelSimulation 0 */
+EParallelForFlags GetSimulationParallelForFlags(int32 Count, int32 MinParallelCount);
+
+/*----------------------------------------------------
+    Serialization tools
+----------------------------------------------------*/
+
+/** Check an element count read from an archive against MaxCount and the remaining bytes, flagging the archive on failure */
+bool IsSerializedCountValid(FArchive& Ar, int32 Count, int64 MinElementSize = 1, int32 MaxCount = MAX_int32);
+
 /*----------------------------------------------------
     Error reporting
 ----------------------------------------------------*/
@@ -50,17 +50,19 @@ void UNovaGameViewportClient::Tick(float DeltaTime)
 	Super::Tick(DeltaTime);
 
 	// Get the current loading screen alpha from the menu manager if valid
-	float             Alpha       = 1;
-	UNovaMenuManager* MenuManager = Cast<UNovaGameInstance>(GetGameInstance())->GetMenuManager();
+	float              Alpha        = 1;
+	UNovaGameInstance* GameInstance = Cast<UNovaGameInstance>(GetGameInstance());
+	UNovaMenuManager*  MenuManager  = GameInstance->GetMenuManager();
 	if (MenuManager)
 	{
 		Alpha = MenuManager->GetLoadingScreenAlpha();
 	}
 
-	// Apply alpha
+	// Apply alpha and load progress
 	if (LoadingScreenWidget.IsValid())
 	{
 		LoadingScreenWidget->SetFadeAlpha(Alpha);
+		LoadingScreenWidget->SetProgress(GameInstance->GetLoadingProgress());
 	}
 }
 
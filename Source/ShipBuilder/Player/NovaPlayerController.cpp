@@ -212,6 +212,22 @@ void ANovaPlayerController::SerializeJson(
 	}
 }
 
+void ANovaPlayerController::SerializeBinary(TSharedPtr<FNovaPlayerSave>& SaveData, FArchive& Ar)
+{
+	if (Ar.IsLoading())
+	{
+		SaveData = MakeShared<FNovaPlayerSave>();
+	}
+
+	// Spacecraft
+	FNovaSpacecraft::SerializeBinary(SaveData->Spacecraft, Ar);
+
+	// Credits
+	int64 Credits = SaveData->Credits.GetValue();
+	Ar << Credits;
+	SaveData->Credits = Credits;
+}
+
 /*----------------------------------------------------
     Inherited
 ----------------------------------------------------*/
@@ -101,6 +101,8 @@ public:
 	static void SerializeJson(
 		TSharedPtr<struct FNovaPlayerSave>& SaveData, TSharedPtr<class FJsonObject>& JsonData, ENovaSerialize Direction);
 
+	static void SerializeBinary(TSharedPtr<struct FNovaPlayerSave>& SaveData, FArchive& Ar);
+
 	/*----------------------------------------------------
 	    Inherited
 	----------------------------------------------------*/
@@ -42,6 +42,12 @@ void UNovaPostProcessComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
+	if (IsRunningDedicatedServer())
+	{
+		SetComponentTickEnabled(false);
+		return;
+	}
+
 	APlayerController* PC = GetOwner<APlayerController>();
 	NCHECK(PC);
 
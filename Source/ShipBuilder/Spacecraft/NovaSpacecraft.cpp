@@ -791,6 +791,76 @@ void FNovaSpacecraft::SerializeJson(TSharedPtr<FNovaSpacecraft>& This, TSharedPt
 	}
 }
 
+void FNovaSpacecraft::SerializeBinary(TSharedPtr<FNovaSpacecraft>& This, FArchive& Ar)
+{
+	if (Ar.IsLoading())
+	{
+		This = MakeShared<FNovaSpacecraft>();
+		This->Create(LOCTEXT("UnnamedSpacecraft", "Unnamed Spacecraft").ToString());
+	}
+
+	// Spacecraft
+	Ar << This->Identifier;
+	Ar << This->Name;
+
+	// Systems
+	Ar << This->PropellantMassAtLaunch;
+
+	// Customization
+	UNovaAssetDescription::SerializeAsset(Ar, This->Customization.StructuralPaint);
+	UNovaAssetDescription::SerializeAsset(Ar, This->Customization.HullPaint);
+	UNovaAssetDescription::SerializeAsset(Ar, This->Customization.DetailPaint);
+	Ar << This->Customization.DirtyIntensity;
+
+	// Compartments, with only valid ones being saved
+	int32 CompartmentCount = 0;
+	for (const FNovaCompartment& Compartment : This->Compartments)
+	{
+		CompartmentCount += Compartment.Description ? 1 : 0;
+	}
+	Ar << CompartmentCount;
+	if (Ar.IsLoading())
+	{
+		if (!IsSerializedCountValid(Ar, CompartmentCount, 1, ENovaConstants::MaxCompartmentCount))
+		{
+			return;
+		}
+		This->Compartments.SetNum(CompartmentCount);
+	}
+
+	for (FNovaCompartment& Compartment : This->Compartments)
+	{
+		if (Ar.IsSaving() && Compartment.Description == nullptr)
+		{
+			continue;
+		}
+
+		// Compartment
+		UNovaAssetDescription::SerializeAsset(Ar, Compartment.Description);
+		UNovaAssetDescription::SerializeAsset(Ar, Compartment.HullType);
+
+		// Modules
+		for (int32 Index = 0; Index < ENovaConstants::MaxModuleCount; Index++)
+		{
+			UNovaAssetDescription::SerializeAsset(Ar, Compartment.Modules[Index].Description);
+		}
+
+		// Equipment
+		for (int32 Index = 0; Index < ENovaConstants::MaxEquipmentCount; Index++)
+		{
+			UNovaAssetDescription::SerializeAsset(Ar, Compartment.Equipment[Index]);
+		}
+
+		// Cargo
+		UNovaAssetDescription::SerializeAsset(Ar, Compartment.GeneralCargo.Resource);
+		Ar << Compartment.GeneralCargo.Amount;
+		UNovaAssetDescription::SerializeAsset(Ar, Compartment.BulkCargo.Resource);
+		Ar << Compartment.BulkCargo.Amount;
+		UNovaAssetDescription::SerializeAsset(Ar, Compartment.LiquidCargo.Resource);
+		Ar << Compartment.LiquidCargo.Amount;
+	}
+}
+
 /*----------------------------------------------------
     Propulsion metrics
 ----------------------------------------------------*/
@@ -906,7 +976,8 @@ void FNovaSpacecraft::UpdatePropulsionMetrics()
 		PropulsionMetrics.MaximumBurnTime = PropulsionMetrics.PropellantMassCapacity / PropulsionMetrics.PropellantRate;
 	}
 
-	PropellantMassAtLaunch = FMath::Min(PropellantMassAtLaunch, PropulsionMetrics.PropellantMassCapacity);
+	PropellantMassAtLaunch    = FMath::Min(PropellantMassAtLaunch, PropulsionMetrics.PropellantMassCapacity);
+	PropulsionMetricsRevision = Revision;
 
 #if 0
 	NLOG("--------------------------------------------------------------------------------");
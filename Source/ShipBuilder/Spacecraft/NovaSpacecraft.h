@@ -340,7 +340,8 @@ public:
 	    Constructor & operators
 	----------------------------------------------------*/
 
-	FNovaSpacecraft() : Identifier(0, 0, 0, 0), SpacecraftClass(nullptr), PropellantMassAtLaunch(0)
+	FNovaSpacecraft()
+		: Identifier(0, 0, 0, 0), SpacecraftClass(nullptr), PropellantMassAtLaunch(0), Revision(1), PropulsionMetricsRevision(0)
 	{}
 
 	bool operator==(const FNovaSpacecraft& Other) const;
@@ -412,6 +413,9 @@ public:
 	/** Serialize the spacecraft */
 	static void SerializeJson(TSharedPtr<FNovaSpacecraft>& This, TSharedPtr<class FJsonObject>& JsonData, ENovaSerialize Direction);
 
+	/** Serialize the spacecraft to or from a binary archive */
+	static void SerializeBinary(TSharedPtr<FNovaSpacecraft>& This, FArchive& Ar);
+
 	/*----------------------------------------------------
 	    Propulsion metrics & cargo hold
 	----------------------------------------------------*/
@@ -428,6 +432,33 @@ public:
 	/** Update the spacecraft's metrics */
 	void UpdatePropulsionMetrics();
 
+	/** Update the spacecraft's metrics only if the spacecraft was modified since the last update */
+	void UpdatePropulsionMetricsIfModified()
+	{
+		if (PropulsionMetricsRevision != Revision)
+		{
+			UpdatePropulsionMetrics();
+		}
+	}
+
+	/** Signal that the spacecraft's assembly was modified and derived data needs to be updated */
+	void MarkModified()
+	{
+		Revision++;
+	}
+
+	/** Replication callback for new spacecraft */
+	void PostReplicatedAdd(const struct FNovaSpacecraftDatabase& InArraySerializer)
+	{
+		MarkModified();
+	}
+
+	/** Replication callback for modified spacecraft */
+	void PostReplicatedChange(const struct FNovaSpacecraftDatabase& InArraySerializer)
+	{
+		MarkModified();
+	}
+
 	/** Reset the propellant amount */
 	void SetPropellantMass(float Amount)
 	{
@@ -529,4 +560,6 @@ public:
 
 	// Local state
 	FNovaSpacecraftPropulsionMetrics PropulsionMetrics;
+	uint32                           Revision;
+	uint32                           PropulsionMetricsRevision;
 };
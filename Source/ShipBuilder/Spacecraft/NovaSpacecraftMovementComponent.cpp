@@ -211,6 +211,19 @@ void UNovaSpacecraftMovementComponent::Reset()
 	DockState.Actor = nullptr;
 }
 
+void UNovaSpacecraftMovementComponent::ClearState()
+{
+	NCHECK(GetLocalRole() == ROLE_Authority);
+	NLOG("UNovaSpacecraftMovementComponent::ClearState");
+
+	DockState       = FNovaMovementDockState();
+	MovementCommand = FNovaMovementCommand(ENovaMovementState::Idle);
+	AttitudeCommand = FNovaAttitudeCommand();
+	CompletionCallback.Unbind();
+
+	ResetState();
+}
+
 bool UNovaSpacecraftMovementComponent::CanDock() const
 {
 	const ANovaGameState* GameState = GetWorld()->GetGameState<ANovaGameState>();
@@ -632,17 +645,21 @@ void UNovaSpacecraftMovementComponent::ProcessOrbitalMovement(float DeltaTime)
 	const ANovaSpacecraftPawn* SpacecraftPawn = GetOwner<ANovaSpacecraftPawn>();
 	NCHECK(SpacecraftPawn);
 
-	// Derive movement from the location of all bodies
+	// Derive movement from the location of all bodies, interpolated between simulation steps
 	if (DockState.Actor)
 	{
-		const FVector2D PlayerLocation     = OrbitalSimulation->GetPlayerCartesianLocation();
-		const FVector2D SpacecraftLocation = OrbitalSimulation->GetSpacecraftCartesianLocation(SpacecraftPawn->GetSpacecraftIdentifier());
+		const FNovaTime PresentationTime = GameState->GetPresentationTime();
+		const FGuid     Identifier       = SpacecraftPawn->GetSpacecraftIdentifier();
+		const FVector2D PlayerLocation   = OrbitalSimulation->GetPlayerLocationAtTime(PresentationTime).GetCartesianLocation();
+		const FVector2D SpacecraftLocation =
+			OrbitalSimulation->GetSpacecraftLocationAtTime(Identifier, PresentationTime).GetCartesianLocation();
 
 		// Get the relative orbital location
 		FVector2D LocationInKilometers;
 		if (!CurrentArea->IsInSpace)
 		{
-			const FVector2D AreaLocation = OrbitalSimulation->GetAreaLocation(CurrentArea).GetCartesianLocation<true>();
+			const FNovaOrbit AreaOrbit    = OrbitalSimulation->GetAreaOrbit(CurrentArea);
+			const FVector2D  AreaLocation = AreaOrbit.GetLocation(PresentationTime).GetCartesianLocation<true>();
 
 			LocationInKilometers = SpacecraftLocation - AreaLocation;
 		}
@@ -109,6 +109,9 @@ public:
 	/** Signal that the area changed */
 	void Reset();
 
+	/** Clear all movement and dock state when the spacecraft leaves play */
+	void ClearState();
+
 	/*** Can we dock */
 	bool CanDock() const;
 
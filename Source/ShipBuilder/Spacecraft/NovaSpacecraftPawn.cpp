@@ -63,6 +63,28 @@ ANovaSpacecraftPawn::ANovaSpacecraftPawn()
     General gameplay
 ----------------------------------------------------*/
 
+void ANovaSpacecraftPawn::BeginPlay()
+{
+	Super::BeginPlay();
+
+	ANovaGameState* GameState = GetWorld()->GetGameState<ANovaGameState>();
+	if (IsValid(GameState))
+	{
+		GameState->RegisterSpacecraftPawn(this);
+	}
+}
+
+void ANovaSpacecraftPawn::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	ANovaGameState* GameState = GetWorld()->GetGameState<ANovaGameState>();
+	if (IsValid(GameState))
+	{
+		GameState->UnregisterSpacecraftPawn(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void ANovaSpacecraftPawn::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
@@ -174,6 +196,22 @@ void ANovaSpacecraftPawn::PossessedBy(AController* NewController)
 			SetAutonomousProxy(false);
 		}
 	}
+
+	OnSpacecraftIdentifierReplicated();
+}
+
+void ANovaSpacecraftPawn::UnPossessed()
+{
+	Super::UnPossessed();
+
+	OnSpacecraftIdentifierReplicated();
+}
+
+void ANovaSpacecraftPawn::OnRep_PlayerState()
+{
+	Super::OnRep_PlayerState();
+
+	OnSpacecraftIdentifierReplicated();
 }
 
 bool ANovaSpacecraftPawn::HasModifications() const
@@ -300,6 +338,15 @@ void ANovaSpacecraftPawn::ServerSaveSystems_Implementation()
 	SaveSystems();
 }
 
+void ANovaSpacecraftPawn::SetSpacecraftIdentifier(FGuid Identifier)
+{
+	if (Identifier != RequestedSpacecraftIdentifier)
+	{
+		RequestedSpacecraftIdentifier = Identifier;
+		OnSpacecraftIdentifierReplicated();
+	}
+}
+
 /*----------------------------------------------------
     Assembly interface
 ----------------------------------------------------*/
@@ -863,6 +910,15 @@ void ANovaSpacecraftPawn::BuildCompartments()
 	UpdateDisplayFilter();
 }
 
+void ANovaSpacecraftPawn::OnSpacecraftIdentifierReplicated()
+{
+	ANovaGameState* GameState = GetWorld()->GetGameState<ANovaGameState>();
+	if (IsValid(GameState))
+	{
+		GameState->OnSpacecraftPawnChanged(this);
+	}
+}
+
 void ANovaSpacecraftPawn::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
@@ -94,10 +94,18 @@ public:
 	    General gameplay
 	----------------------------------------------------*/
 
+	virtual void BeginPlay() override;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	virtual void Tick(float DeltaTime) override;
 
 	virtual void PossessedBy(AController* NewController) override;
 
+	virtual void UnPossessed() override;
+
+	virtual void OnRep_PlayerState() override;
+
 	virtual TPair<FVector, FVector> GetTurntableBounds() const override
 	{
 		return TPair<FVector, FVector>(CurrentOrigin, CurrentExtent);
@@ -110,10 +118,7 @@ public:
 	}
 
 	/** Share the identifier for the player spacecraft */
-	void SetSpacecraftIdentifier(FGuid Identifier)
-	{
-		RequestedSpacecraftIdentifier = Identifier;
-	}
+	void SetSpacecraftIdentifier(FGuid Identifier);
 
 	/** Return the spacecraft identifier */
 	UFUNCTION(Category = Nova, BlueprintCallable)
@@ -356,6 +361,10 @@ protected:
 	/** Build compartments */
 	void BuildCompartments();
 
+	/** Identifier replication event */
+	UFUNCTION()
+	void OnSpacecraftIdentifierReplicated();
+
 	/*----------------------------------------------------
 	    Properties
 	----------------------------------------------------*/
@@ -384,7 +393,7 @@ protected:
 	----------------------------------------------------*/
 
 	// Identifier
-	UPROPERTY(Replicated)
+	UPROPERTY(ReplicatedUsing = OnSpacecraftIdentifierReplicated)
 	FGuid RequestedSpacecraftIdentifier;
 
 	// Assembly data
@@ -4,6 +4,7 @@
 
 #include "Game/NovaOrbitalSimulationComponent.h"
 
+#include "Algo/BinarySearch.h"
 #include "Net/UnrealNetwork.h"
 
 /*----------------------------------------------------
@@ -16,10 +17,32 @@ UNovaSpacecraftPropellantSystem::UNovaSpacecraftPropellantSystem()
 	, InitialPropellantMass(0)
 	, PropellantMass(0)
 	, PropellantRate(0)
+
+	, TableDeltaV(0)
+	, TablePropulsionRate(0)
+	, TableSpacecraftIndex(INDEX_NONE)
 {
 	SetIsReplicatedByDefault(true);
 }
 
+/*----------------------------------------------------
+    Inherited
+----------------------------------------------------*/
+
+void UNovaSpacecraftPropellantSystem::BeginPlay()
+{
+	Super::BeginPlay();
+
+	RegisterSystem();
+}
+
+void UNovaSpacecraftPropellantSystem::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnregisterSystem();
+
+	Super::EndPlay(EndPlayReason);
+}
+
 /*----------------------------------------------------
     System implementation
 ----------------------------------------------------*/
@@ -40,23 +63,33 @@ void UNovaSpacecraftPropellantSystem::Update(FNovaTime InitialTime, FNovaTime Fi
 		const FNovaTrajectory* Trajectory = Simulation->GetSpacecraftTrajectory(Identifier);
 		if (Trajectory)
 		{
-			PropellantMass = InitialPropellantMass;
+			UpdateConsumptionTable(*Trajectory, PropulsionMetrics->PropellantRate, Simulation->GetSpacecraftTrajectoryIndex(Identifier));
+
+			// Find the number of maneuvers that started before the final time
+			const int32 StartedManeuverCount = Algo::LowerBound(ManeuverStartTimes, FinalTime);
+			double      PropellantUsage      = 0;
 
-			for (const FNovaManeuver& Maneuver : Trajectory->Maneuvers)
+			// Completed maneuvers come from the table, the last started one is integrated up to the final time
+			if (StartedManeuverCount > 0)
 			{
-				FNovaTime ManeuverEndTime          = FMath::Min(Maneuver.Time + Maneuver.Duration, FinalTime);
-				FNovaTime AdjustedManeuverDuration = ManeuverEndTime - Maneuver.Time;
-				double    DeltaTimeSeconds         = AdjustedManeuverDuration.AsSeconds();
+				const int32 ManeuverIndex = StartedManeuverCount - 1;
+				if (ManeuverIndex > 0)
+				{
+					PropellantUsage = CumulativePropellantUsage[ManeuverIndex - 1];
+					PropellantRate  = CumulativePropellantRates[ManeuverIndex - 1];
+				}
 
+				const FNovaTime ManeuverEndTime  = FMath::Min(ManeuverEndTimes[ManeuverIndex], FinalTime);
+				const double    DeltaTimeSeconds = (ManeuverEndTime - ManeuverStartTimes[ManeuverIndex]).AsSeconds();
 				if (DeltaTimeSeconds > 0)
 				{
-					int32 SpacecraftIndex = Simulation->GetSpacecraftTrajectoryIndex(Identifier);
-					NCHECK(SpacecraftIndex != INDEX_NONE && SpacecraftIndex >= 0 && SpacecraftIndex < Maneuver.ThrustFactors.Num());
-
-					PropellantRate = PropulsionMetrics->PropellantRate * Maneuver.ThrustFactors[SpacecraftIndex];
-					PropellantMass -= PropellantRate * DeltaTimeSeconds;
+					PropellantRate = ManeuverRates[ManeuverIndex];
+					PropellantUsage += PropellantRate * DeltaTimeSeconds;
 				}
 			}
+
+			PropellantMass = InitialPropellantMass - PropellantUsage;
+
 #if 0
 			NLOG("PropellantRate %f, InitialPropellantMass %f, PropellantMass %f", PropellantRate, InitialPropellantMass, PropellantMass);
 #endif
@@ -66,6 +99,57 @@ void UNovaSpacecraftPropellantSystem::Update(FNovaTime InitialTime, FNovaTime Fi
 	}
 }
 
+/*----------------------------------------------------
+    Internals
+----------------------------------------------------*/
+
+void UNovaSpacecraftPropellantSystem::UpdateConsumptionTable(
+	const FNovaTrajectory& Trajectory, float PropulsionRate, int32 SpacecraftIndex)
+{
+	const FNovaTime StartTime = Trajectory.Maneuvers.Num() ? Trajectory.Maneuvers[0].Time : FNovaTime();
+
+	// Check whether the table is still valid for this trajectory
+	if (ManeuverStartTimes.Num() == Trajectory.Maneuvers.Num() && TableStartTime == StartTime &&
+		TableTravelDuration == Trajectory.TotalTravelDuration && TableDeltaV == Trajectory.TotalDeltaV &&
+		TablePropulsionRate == PropulsionRate && TableSpacecraftIndex == SpacecraftIndex)
+	{
+		return;
+	}
+
+	TableStartTime       = StartTime;
+	TableTravelDuration  = Trajectory.TotalTravelDuration;
+	TableDeltaV          = Trajectory.TotalDeltaV;
+	TablePropulsionRate  = PropulsionRate;
+	TableSpacecraftIndex = SpacecraftIndex;
+
+	ManeuverStartTimes.Reset(Trajectory.Maneuvers.Num());
+	ManeuverEndTimes.Reset(Trajectory.Maneuvers.Num());
+	ManeuverRates.Reset(Trajectory.Maneuvers.Num());
+	CumulativePropellantUsage.Reset(Trajectory.Maneuvers.Num());
+	CumulativePropellantRates.Reset(Trajectory.Maneuvers.Num());
+
+	// Integrate consumption over the complete trajectory
+	double PropellantUsage = 0;
+	float  CurrentRate     = 0;
+	for (const FNovaManeuver& Maneuver : Trajectory.Maneuvers)
+	{
+		NCHECK(SpacecraftIndex != INDEX_NONE && SpacecraftIndex >= 0 && SpacecraftIndex < Maneuver.ThrustFactors.Num());
+
+		const float Rate = PropulsionRate * Maneuver.ThrustFactors[SpacecraftIndex];
+		if (Maneuver.Duration.AsSeconds() > 0)
+		{
+			CurrentRate = Rate;
+			PropellantUsage += Rate * Maneuver.Duration.AsSeconds();
+		}
+
+		ManeuverStartTimes.Add(Maneuver.Time);
+		ManeuverEndTimes.Add(Maneuver.Time + Maneuver.Duration);
+		ManeuverRates.Add(Rate);
+		CumulativePropellantUsage.Add(PropellantUsage);
+		CumulativePropellantRates.Add(CurrentRate);
+	}
+}
+
 void UNovaSpacecraftPropellantSystem::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
@@ -20,6 +20,14 @@ class UNovaSpacecraftPropellantSystem
 public:
 	UNovaSpacecraftPropellantSystem();
 
+	/*----------------------------------------------------
+	    Inherited
+	----------------------------------------------------*/
+
+	virtual void BeginPlay() override;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	/*----------------------------------------------------
 	    System implementation
 	----------------------------------------------------*/
@@ -82,6 +90,14 @@ public:
 		}
 	}
 
+	/*----------------------------------------------------
+	    Internals
+	----------------------------------------------------*/
+
+protected:
+	/** Rebuild the cumulative consumption table if the trajectory or propulsion changed */
+	void UpdateConsumptionTable(const FNovaTrajectory& Trajectory, float PropulsionRate, int32 SpacecraftIndex);
+
 	/*----------------------------------------------------
 	    Data
 	----------------------------------------------------*/
@@ -98,4 +114,18 @@ protected:
 	// Current rate of consumption
 	UPROPERTY(Replicated)
 	float PropellantRate;
+
+	// Consumption table key
+	FNovaTime TableStartTime;
+	FNovaTime TableTravelDuration;
+	double    TableDeltaV;
+	float     TablePropulsionRate;
+	int32     TableSpacecraftIndex;
+
+	// Consumption table, with the propellant used and the last active rate at the end of each maneuver
+	TArray<FNovaTime> ManeuverStartTimes;
+	TArray<FNovaTime> ManeuverEndTimes;
+	TArray<float>     ManeuverRates;
+	TArray<double>    CumulativePropellantUsage;
+	TArray<float>     CumulativePropellantRates;
 };
@@ -42,12 +42,44 @@ public:
 	    System helpers
 	----------------------------------------------------*/
 
-	/** Get the owning spacecraft's identifier */
-	FGuid GetSpacecraftIdentifier() const
+	/** Register the system with the game state, to be called on BeginPlay */
+	void RegisterSystem()
+	{
+		const UActorComponent* ThisComponent = Cast<UActorComponent>(this);
+		NCHECK(ThisComponent);
+
+		ANovaGameState* GameState = ThisComponent->GetWorld()->GetGameState<ANovaGameState>();
+		if (IsValid(GameState))
+		{
+			GameState->RegisterSpacecraftSystem(this);
+		}
+	}
+
+	/** Unregister the system from the game state, to be called on EndPlay */
+	void UnregisterSystem()
 	{
 		const UActorComponent* ThisComponent = Cast<UActorComponent>(this);
 		NCHECK(ThisComponent);
-		return ThisComponent->GetOwner<ANovaSpacecraftPawn>()->GetSpacecraftIdentifier();
+
+		ANovaGameState* GameState = ThisComponent->GetWorld()->GetGameState<ANovaGameState>();
+		if (IsValid(GameState))
+		{
+			GameState->UnregisterSpacecraftSystem(this);
+		}
+	}
+
+	/** Get the owning spacecraft pawn */
+	ANovaSpacecraftPawn* GetSpacecraftPawn() const
+	{
+		const UActorComponent* ThisComponent = Cast<UActorComponent>(this);
+		NCHECK(ThisComponent);
+		return ThisComponent->GetOwner<ANovaSpacecraftPawn>();
+	}
+
+	/** Get the owning spacecraft's identifier */
+	FGuid GetSpacecraftIdentifier() const
+	{
+		return GetSpacecraftPawn()->GetSpacecraftIdentifier();
 	}
 
 	/** Get the owning spacecraft */
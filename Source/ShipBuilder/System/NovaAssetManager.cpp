@@ -87,6 +87,17 @@ const UNovaAssetDescription* UNovaAssetDescription::LoadAsset(TSharedPtr<FJsonOb
 	return Asset;
 };
 
+void UNovaAssetDescription::SerializeAsset(FArchive& Ar, const UNovaAssetDescription*& Asset)
+{
+	UObject* Object = const_cast<UNovaAssetDescription*>(Asset);
+	Ar << Object;
+
+	if (Ar.IsLoading())
+	{
+		Asset = Cast<UNovaAssetDescription>(Object);
+	}
+}
+
 struct FNovaAssetPreviewSettings UNovaAssetDescription::GetPreviewSettings() const
 {
 	return FNovaAssetPreviewSettings();
@@ -96,7 +107,7 @@ struct FNovaAssetPreviewSettings UNovaAssetDescription::GetPreviewSettings() con
     Constructor
 ----------------------------------------------------*/
 
-UNovaAssetManager::UNovaAssetManager() : Super()
+UNovaAssetManager::UNovaAssetManager() : Super(), CatalogRevision(0)
 {}
 
 /*----------------------------------------------------
@@ -107,6 +118,7 @@ void UNovaAssetManager::Initialize()
 {
 	Singleton = this;
 	Catalog.Empty();
+	CatalogRevision++;
 
 	IAssetRegistry& Registry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
 
@@ -152,6 +164,19 @@ void UNovaAssetManager::LoadAssets(TArray<FSoftObjectPath> Assets, FStreamableDe
 	StreamableManager.RequestAsyncLoad(Assets, Callback);
 }
 
+TSharedPtr<FStreamableHandle> UNovaAssetManager::PrefetchAssets(TArray<FSoftObjectPath> Assets)
+{
+	return StreamableManager.RequestAsyncLoad(Assets, FStreamableDelegate(), FStreamableManager::DefaultAsyncLoadPriority - 1);
+}
+
+int64 UNovaAssetManager::GetAssetSize(FSoftObjectPath Asset) const
+{
+	IAssetRegistry&          Registry    = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	const FAssetPackageData* PackageData = Registry.GetAssetPackageData(FName(*Asset.GetLongPackageName()));
+
+	return PackageData ? PackageData->DiskSize : 0;
+}
+
 void UNovaAssetManager::UnloadAsset(FSoftObjectPath Asset)
 {
 	StreamableManager.Unload(Asset);
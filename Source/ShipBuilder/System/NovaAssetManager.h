@@ -62,6 +62,20 @@ public:
 		return Cast<T>(LoadAsset(Save, AssetName));
 	}
 
+	// Write or read an asset description in a binary archive, which must support object references
+	static void SerializeAsset(FArchive& Ar, const UNovaAssetDescription*& Asset);
+
+	template <typename T>
+	static void SerializeAsset(FArchive& Ar, const T*& Asset)
+	{
+		const UNovaAssetDescription* Description = Asset;
+		SerializeAsset(Ar, Description);
+		if (Ar.IsLoading())
+		{
+			Asset = Cast<T>(Description);
+		}
+	}
+
 	/** Get a list of assets to load before use*/
 	virtual TArray<FSoftObjectPath> GetAsyncAssets() const
 	{
@@ -167,6 +181,12 @@ public:
 		return Result;
 	}
 
+	/** Get a counter that changes every time the catalog is rebuilt, to invalidate data derived from it */
+	int32 GetCatalogRevision() const
+	{
+		return CatalogRevision;
+	}
+
 	/** Find the default asset of a class */
 	template <typename T>
 	const T* GetDefaultAsset() const
@@ -191,6 +211,12 @@ public:
 	/** Load a collection of assets asynchronously */
 	void LoadAssets(TArray<FSoftObjectPath> Assets, FStreamableDelegate Callback);
 
+	/** Load a collection of assets asynchronously at low priority, keeping them loaded while the handle is alive */
+	TSharedPtr<struct FStreamableHandle> PrefetchAssets(TArray<FSoftObjectPath> Assets);
+
+	/** Get the size in bytes of the package holding an asset, as recorded by the asset registry */
+	int64 GetAssetSize(FSoftObjectPath Asset) const;
+
 	/** Unload an asset asynchronously */
 	void UnloadAsset(FSoftObjectPath Asset);
 
@@ -209,6 +235,9 @@ public:
 	UPROPERTY()
 	TMap<TSubclassOf<UNovaAssetDescription>, const UNovaAssetDescription*> DefaultAssets;
 
+	// Catalog rebuild counter
+	int32 CatalogRevision;
+
 	// Asynchronous asset loader
 	FStreamableManager StreamableManager;
 };
@@ -2,6 +2,7 @@
 
 #include "NovaContractManager.h"
 #include "NovaGameInstance.h"
+#include "NovaSaveManager.h"
 
 #include "Game/Contract/NovaContract.h"
 #include "Player/NovaPlayerController.h"
@@ -126,6 +127,43 @@ void UNovaContractManager::SerializeJson(
 	}
 }
 
+void UNovaContractManager::SerializeBinary(TSharedPtr<FNovaContractManagerSave>& SaveData, FArchive& Ar)
+{
+	if (Ar.IsLoading())
+	{
+		SaveData = MakeShared<FNovaContractManagerSave>();
+	}
+
+	// Contracts store their own state as JSON objects, which are kept as strings here
+	int32 ContractCount = SaveData->CurrentContracts.Num();
+	Ar << ContractCount;
+	if (Ar.IsSaving())
+	{
+		for (TPair<ENovaContractType, TSharedPtr<FJsonObject>> ContractData : SaveData->CurrentContracts)
+		{
+			uint8   ContractType   = static_cast<uint8>(ContractData.Key);
+			FString ContractString = UNovaSaveManager::JsonToString(ContractData.Value);
+			Ar << ContractType;
+			Ar << ContractString;
+		}
+	}
+	else
+	{
+		for (int32 Index = 0; Index < ContractCount; Index++)
+		{
+			uint8   ContractType = 0;
+			FString ContractString;
+			Ar << ContractType;
+			Ar << ContractString;
+
+			SaveData->CurrentContracts.Add(TPair<ENovaContractType, TSharedPtr<FJsonObject>>(
+				static_cast<ENovaContractType>(ContractType), UNovaSaveManager::StringToJson(ContractString)));
+		}
+	}
+
+	Ar << SaveData->CurrentTrackedContract;
+}
+
 /*----------------------------------------------------
     System interface
 ----------------------------------------------------*/
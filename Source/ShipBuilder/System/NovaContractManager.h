@@ -50,6 +50,8 @@ public:
 	static void SerializeJson(
 		TSharedPtr<struct FNovaContractManagerSave>& SaveData, TSharedPtr<class FJsonObject>& JsonData, ENovaSerialize Direction);
 
+	static void SerializeBinary(TSharedPtr<struct FNovaContractManagerSave>& SaveData, FArchive& Ar);
+
 	/*----------------------------------------------------
 	    System interface
 	----------------------------------------------------*/
@@ -35,16 +35,26 @@ UNovaGameInstance::UNovaGameInstance() : Super(), CurrentSaveData(nullptr), Time
     Loading & saving
 ----------------------------------------------------*/
 
+/** Immutable snapshot of the game, with sections shared between snapshots but never modified once saved */
 struct FNovaGameSave
 {
 	TSharedPtr<struct FNovaPlayerSave>          PlayerData;
 	TSharedPtr<struct FNovaGameStateSave>       GameStateData;
 	TSharedPtr<struct FNovaContractManagerSave> ContractManagerData;
+
+	FNovaSaveMetadata Metadata;
 };
 
 TSharedPtr<FNovaGameSave> UNovaGameInstance::Save(const ANovaPlayerController* PC)
 {
-	TSharedPtr<FNovaGameSave> Save = CurrentSaveData;
+	int64 Cycles = FPlatformTime::Cycles64();
+
+	// Start a new snapshot from the previous one, so that background saves never see data change
+	TSharedPtr<FNovaGameSave> Save = MakeShared<FNovaGameSave>();
+	if (CurrentSaveData.IsValid())
+	{
+		*Save = *CurrentSaveData;
+	}
 
 	// Save the player
 	Save->PlayerData = PC->Save();
@@ -62,9 +72,23 @@ TSharedPtr<FNovaGameSave> UNovaGameInstance::Save(const ANovaPlayerController* P
 	// Save contracts
 	Save->ContractManagerData = ContractManager->Save();
 
+	// Summarize the save for the slot list
+	const ANovaGameState*  GameState  = GetWorld()->GetGameState<ANovaGameState>();
+	const FNovaSpacecraft* Spacecraft = PC->GetSpacecraft();
+	Save->Metadata.Timestamp          = FDateTime::UtcNow();
+	Save->Metadata.Credits            = PC->GetAccountBalance();
+	Save->Metadata.SpacecraftName     = Spacecraft ? Spacecraft->GetName().ToString() : FString();
+	if (IsValid(GameState))
+	{
+		Save->Metadata.GameTime    = GameState->GetCurrentTime();
+		Save->Metadata.CurrentArea = GameState->GetCurrentArea();
+	}
+
 	// Reset the save time
 	TimeOfLastSave = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64());
 
+	NLOG("UNovaGameInstance::Save : captured snapshot in %.2fms", FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Cycles));
+
 	return Save;
 }
 
@@ -119,6 +143,85 @@ void UNovaGameInstance::SerializeJson(TSharedPtr<FNovaGameSave>& SaveData, TShar
 	}
 }
 
+void UNovaGameInstance::SerializeBinary(TSharedPtr<FNovaGameSave>& SaveData, FArchive& Ar)
+{
+	if (Ar.IsLoading())
+	{
+		SaveData = MakeShared<FNovaGameSave>();
+	}
+
+	for (uint8 Section = 0; Section < static_cast<uint8>(ENovaSaveSection::Count); Section++)
+	{
+		SerializeBinary(SaveData, static_cast<ENovaSaveSection>(Section), Ar);
+	}
+}
+
+const FNovaSaveMetadata& UNovaGameInstance::GetMetadata(const TSharedPtr<FNovaGameSave>& SaveData)
+{
+	NCHECK(SaveData.IsValid());
+
+	return SaveData->Metadata;
+}
+
+void UNovaGameInstance::SerializeBinary(TSharedPtr<FNovaGameSave>& SaveData, ENovaSaveSection Section, FArchive& Ar)
+{
+	NCHECK(SaveData.IsValid());
+
+	UNovaSaveManager::SerializeWithAssetTable(Ar,
+		[&](FArchive& AssetAr)
+		{
+			switch (Section)
+			{
+				case ENovaSaveSection::Player:
+					ANovaPlayerController::SerializeBinary(SaveData->PlayerData, AssetAr);
+					break;
+
+				case ENovaSaveSection::GameState:
+					ANovaGameState::SerializeBinary(SaveData->GameStateData, AssetAr);
+					break;
+
+				case ENovaSaveSection::ContractManager:
+					UNovaContractManager::SerializeBinary(SaveData->ContractManagerData, AssetAr);
+					break;
+
+				default:
+					NCHECK(false);
+			}
+		});
+}
+
+void UNovaGameInstance::SerializeBinaryGameStateHeader(TSharedPtr<FNovaGameSave>& SaveData, FArchive& Ar)
+{
+	NCHECK(SaveData.IsValid());
+
+	UNovaSaveManager::SerializeWithAssetTable(Ar,
+		[&](FArchive& AssetAr)
+		{
+			ANovaGameState::SerializeBinaryHeader(SaveData->GameStateData, AssetAr);
+		});
+}
+
+int32 UNovaGameInstance::SerializeBinaryAIDelta(TSharedPtr<FNovaGameSave>& SaveData, const TMap<FGuid, uint32>& Revisions, FArchive& Ar)
+{
+	NCHECK(SaveData.IsValid());
+
+	int32 Count = 0;
+	UNovaSaveManager::SerializeWithAssetTable(Ar,
+		[&](FArchive& AssetAr)
+		{
+			Count = ANovaGameState::SerializeBinaryAIDelta(SaveData->GameStateData, Revisions, AssetAr);
+		});
+
+	return Count;
+}
+
+void UNovaGameInstance::GetAIRevisions(const TSharedPtr<FNovaGameSave>& SaveData, TMap<FGuid, uint32>& Revisions)
+{
+	NCHECK(SaveData.IsValid());
+
+	ANovaGameState::GetAIRevisions(SaveData->GameStateData, Revisions);
+}
+
 /*----------------------------------------------------
     Inherited
 ----------------------------------------------------*/
@@ -151,12 +254,17 @@ void UNovaGameInstance::Init()
 	// Create the menu manager
 	MenuManager = NewObject<UNovaMenuManager>(this, UNovaMenuManager::StaticClass(), TEXT("MenuManager"));
 	NCHECK(MenuManager);
-	MenuManager->Initialize(this);
 
 	// Create the sound manager
 	SoundManager = NewObject<UNovaSoundManager>(this, UNovaSoundManager::StaticClass(), TEXT("SoundManager"));
 	NCHECK(SoundManager);
-	SoundManager->Initialize(this);
+
+	// Presentation managers stay uninitialized on dedicated servers
+	if (!IsRunningDedicatedServer())
+	{
+		MenuManager->Initialize(this);
+		SoundManager->Initialize(this);
+	}
 
 	// Create the contract manager
 	ContractManager = NewObject<UNovaContractManager>(this, UNovaContractManager::StaticClass(), TEXT("ContractManager"));
@@ -170,6 +278,26 @@ void UNovaGameInstance::Shutdown()
 	Super::Shutdown();
 }
 
+void UNovaGameInstance::OnStart()
+{
+	Super::OnStart();
+
+	// Dedicated servers host the save slot passed with -SaveSlot=, in an online session when possible
+	if (IsRunningDedicatedServer())
+	{
+		FString SaveName = TEXT("1");
+		FParse::Value(FCommandLine::Get(), TEXT("SaveSlot="), SaveName);
+
+		NLOG("UNovaGameInstance::OnStart : starting dedicated server from '%s'", *SaveName);
+		LoadGame(SaveName);
+
+		if (!SessionsManager->StartDedicatedSession(ENovaConstants::DefaultLevel, ENovaConstants::MaxPlayerCount))
+		{
+			ServerTravel(ENovaConstants::DefaultLevel);
+		}
+	}
+}
+
 void UNovaGameInstance::PreLoadMap(const FString& InMapName)
 {
 	UNovaGameViewportClient* Viewport = Cast<UNovaGameViewportClient>(GetWorld()->GetGameViewport());
@@ -185,11 +313,12 @@ void UNovaGameInstance::PreLoadMap(const FString& InMapName)
 
 void UNovaGameInstance::StartGame(FString SaveName, bool Online)
 {
-	NLOG("UNovaGameInstance::StartGame");
+	NLOG("UNovaGameInstance::StartGame : loading from '%s'", *SaveName);
 
-	LoadGame(SaveName);
+	CurrentSaveData     = nullptr;
+	CurrentSaveFileName = SaveName;
 
-	SetGameOnline(ENovaConstants::DefaultLevel, Online);
+	SaveManager->LoadGameAsync(SaveName, FNovaGameLoaded::CreateUObject(this, &UNovaGameInstance::OnGameLoaded, Online));
 }
 
 void UNovaGameInstance::LoadGame(FString SaveName)
@@ -226,13 +355,14 @@ void UNovaGameInstance::SaveGameToFile(bool Synchronous)
 
 	if (CurrentSaveData.IsValid())
 	{
+		// Synchronous saves happen when leaving the game and write a compact full save, background saves favor speed
 		if (Synchronous)
 		{
-			SaveManager->SaveGame(CurrentSaveFileName, CurrentSaveData);
+			SaveManager->SaveGame(CurrentSaveFileName, CurrentSaveData, true, ENovaSaveCompression::Default);
 		}
 		else
 		{
-			SaveManager->SaveGameAsync(CurrentSaveFileName, CurrentSaveData);
+			SaveManager->SaveGameAsync(CurrentSaveFileName, CurrentSaveData, true, ENovaSaveCompression::Fast, true);
 		}
 	}
 }
@@ -242,6 +372,11 @@ bool UNovaGameInstance::HasSave() const
 	return CurrentSaveData.IsValid();
 }
 
+TOptional<float> UNovaGameInstance::GetLoadingProgress() const
+{
+	return SaveManager ? SaveManager->GetLoadingProgress() : TOptional<float>();
+}
+
 TSharedPtr<FNovaPlayerSave> UNovaGameInstance::GetPlayerSave()
 {
 	NCHECK(CurrentSaveData);
@@ -304,4 +439,18 @@ void UNovaGameInstance::ServerTravel(FString URL)
 	GetWorld()->ServerTravel(URL + TEXT("?listen"), true);
 }
 
+/*----------------------------------------------------
+    Internals
+----------------------------------------------------*/
+
+void UNovaGameInstance::OnGameLoaded(TSharedPtr<FNovaGameSave> SaveData, bool Online)
+{
+	NLOG("UNovaGameInstance::OnGameLoaded : online = %d", Online);
+
+	NCHECK(SaveData);
+	Load(SaveData);
+
+	SetGameOnline(ENovaConstants::DefaultLevel, Online);
+}
+
 #undef LOCTEXT_NAMESPACE
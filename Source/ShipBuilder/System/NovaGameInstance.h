@@ -28,6 +28,18 @@ public:
 	static void SerializeJson(
 		TSharedPtr<struct FNovaGameSave>& SaveData, TSharedPtr<class FJsonObject>& JsonData, ENovaSerialize Direction);
 
+	static void SerializeBinary(TSharedPtr<struct FNovaGameSave>& SaveData, FArchive& Ar);
+
+	static void SerializeBinary(TSharedPtr<struct FNovaGameSave>& SaveData, ENovaSaveSection Section, FArchive& Ar);
+
+	static void SerializeBinaryGameStateHeader(TSharedPtr<struct FNovaGameSave>& SaveData, FArchive& Ar);
+
+	static int32 SerializeBinaryAIDelta(TSharedPtr<struct FNovaGameSave>& SaveData, const TMap<FGuid, uint32>& Revisions, FArchive& Ar);
+
+	static void GetAIRevisions(const TSharedPtr<struct FNovaGameSave>& SaveData, TMap<FGuid, uint32>& Revisions);
+
+	static const struct FNovaSaveMetadata& GetMetadata(const TSharedPtr<struct FNovaGameSave>& SaveData);
+
 	/*----------------------------------------------------
 	    Inherited & callbacks
 	----------------------------------------------------*/
@@ -36,13 +48,15 @@ public:
 
 	virtual void Shutdown() override;
 
+	virtual void OnStart() override;
+
 	void PreLoadMap(const FString& InMapName);
 
 	/*----------------------------------------------------
 	    Game save handling
 	----------------------------------------------------*/
 
-	/** Start the game from a save file */
+	/** Start the game from a save file, loaded in the background */
 	void StartGame(FString SaveName, bool Online = true);
 
 	/** Try loading the game from the save slot if it exists, or create a new one */
@@ -57,6 +71,9 @@ public:
 	/** Check that the current save data is valid */
 	bool HasSave() const;
 
+	/** Get the progress of the game being loaded, if any */
+	TOptional<float> GetLoadingProgress() const;
+
 	/** Get the time in minutes since the last loading or saving */
 	double GetMinutesSinceLastSave() const
 	{
@@ -84,6 +101,12 @@ public:
 		return AssetManager;
 	}
 
+	/** Get the save manager */
+	class UNovaSaveManager* GetSaveManager() const
+	{
+		return SaveManager;
+	}
+
 	/** Get the contract manager */
 	class UNovaContractManager* GetContractManager() const
 	{
@@ -117,6 +140,10 @@ public:
 	/** Change level on the server */
 	void ServerTravel(FString URL);
 
+protected:
+	/** Apply save data loaded in the background, and start the game */
+	void OnGameLoaded(TSharedPtr<struct FNovaGameSave> SaveData, bool Online);
+
 private:
 	/*----------------------------------------------------
 	    Data
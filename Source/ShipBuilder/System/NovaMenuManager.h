@@ -75,7 +75,7 @@ public:
 	virtual void              Tick(float DeltaTime) override;
 	virtual ETickableTickType GetTickableTickType() const override
 	{
-		return ETickableTickType::Always;
+		return IsRunningDedicatedServer() ? ETickableTickType::Never : ETickableTickType::Always;
 	}
 	virtual TStatId GetStatId() const override
 	{
@@ -2,7 +2,9 @@
 
 #include "NovaSaveManager.h"
 #include "NovaGameInstance.h"
+#include "NovaAssetManager.h"
 
+#include "Game/NovaArea.h"
 #include "Game/NovaGameTypes.h"
 #include "Nova.h"
 
@@ -11,279 +13,1326 @@
 #include "HAL/FileManager.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "Async/Async.h"
 #include "Async/AsyncWork.h"
+#include "Async/ParallelFor.h"
 #include "Serialization/JsonWriter.h"
 #include "Serialization/JsonSerializer.h"
+#include "Serialization/MemoryReader.h"
 #include "Policies/CondensedJsonPrintPolicy.h"
 
+// Binary save identification, with version 2 adding asset tables to sections
+static constexpr uint32 BinarySaveMagic   = 0x5641534E;    // "NSAV"
+static constexpr uint32 BinarySaveVersion = 2;
+
+// Version of the binary data being read, stored as a custom version on loading archives
+static const FGuid BinarySaveVersionGuid(0x4E4F5641, 0x53415645, 0x56455253, 0x494F4E31);
+
+// Compressed file identification, streaming chunk size and number of chunks compressed in parallel
+// Chunked files first stored zlib data without naming the codec, these are still read
+static constexpr uint32 ChunkedSaveMagic     = 0x4356534E;    // "NSVC"
+static constexpr uint32 ZlibChunkedSaveMagic = 0x5A56534E;    // "NSVZ"
+static constexpr int32  SaveChunkSize        = 64 * 1024;
+static constexpr int32  SaveChunkBatchSize   = 8;
+
+// Upper bound of the zlib compression ratio, used to reject corrupted sizes before allocating
+static constexpr int64 MaxSaveCompressionRatio = 1032;
+
+// Delta journal & slot summary identification
+static constexpr uint32 JournalSaveMagic  = 0x4A56534E;    // "NSVJ"
+static constexpr uint32 MetadataSaveMagic = 0x4D56534E;    // "NSVM"
+
+/** Records stored in journal entries, starting with complete sections as found in full saves */
+enum class ENovaSaveJournalRecord : uint8
+{
+	Player          = static_cast<uint8>(ENovaSaveSection::Player),
+	GameState       = static_cast<uint8>(ENovaSaveSection::GameState),
+	ContractManager = static_cast<uint8>(ENovaSaveSection::ContractManager),
+	GameStateHeader = static_cast<uint8>(ENovaSaveSection::Count),
+	AISpacecraft,
+	Count
+};
+
+DECLARE_MEMORY_STAT(TEXT("Save serialized size"), STAT_NovaSaveSerializedSize, STATGROUP_Nova);
+DECLARE_MEMORY_STAT(TEXT("Save compressed size"), STAT_NovaSaveCompressedSize, STATGROUP_Nova);
+DECLARE_MEMORY_STAT(TEXT("Save written size"), STAT_NovaSaveWrittenSize, STATGROUP_Nova);
+DECLARE_MEMORY_STAT(TEXT("Save peak buffer size"), STAT_NovaSavePeakBufferSize, STATGROUP_Nova);
+
+static TAutoConsoleVariable<int32> CVarExportJsonSaves(
+	TEXT("nova.ExportJsonSaves"), 0, TEXT("Write a JSON copy of binary saves for debugging"), ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarSaveJournalLength(TEXT("nova.SaveJournalLength"), 10,
+	TEXT("Number of incremental saves appended to the journal before compacting it into a full save"), ECVF_Default);
+
+/*----------------------------------------------------
+    Streaming compressed writer
+----------------------------------------------------*/
+
+/** Get the compression format and flags to use for a compression setting */
+static FName GetCompressionFormat(ENovaSaveCompression Compression, ECompressionFlags& Flags)
+{
+	static const FName OodleFormat = TEXT("Oodle");
+
+	switch (Compression)
+	{
+		case ENovaSaveCompression::Fast:
+			Flags = COMPRESS_BiasSpeed;
+			return FCompression::IsFormatValid(OodleFormat) ? OodleFormat : NAME_LZ4;
+
+		default:
+			Flags = COMPRESS_NoFlags;
+			return NAME_Zlib;
+	}
+}
+
+/** Archive splitting serialized data in fixed-size chunks, compressed in parallel batches and written to a file in order */
+class FNovaCompressedSaveWriter : public FArchive
+{
+public:
+	FNovaCompressedSaveWriter(FArchive* FileWriter, ENovaSaveCompression Compression)
+		: File(FileWriter), CurrentChunk(0), SerializedSize(0), CompressedSize(0), WrittenSize(0)
+	{
+		SetIsSaving(true);
+		SetIsPersistent(true);
+
+		Format = GetCompressionFormat(Compression, Flags);
+
+		// Allocate all bounded buffers once
+		const int32 CompressedChunkSize = FCompression::CompressMemoryBound(Format, SaveChunkSize, Flags);
+		UncompressedChunks.SetNum(SaveChunkBatchSize);
+		CompressedChunks.SetNum(SaveChunkBatchSize);
+		CompressedChunkSizes.SetNum(SaveChunkBatchSize);
+		for (int32 ChunkIndex = 0; ChunkIndex < SaveChunkBatchSize; ChunkIndex++)
+		{
+			UncompressedChunks[ChunkIndex].Reserve(SaveChunkSize);
+			CompressedChunks[ChunkIndex].SetNumUninitialized(CompressedChunkSize);
+		}
+
+		// Write the header with the codec used
+		uint32  Magic      = ChunkedSaveMagic;
+		FString FormatName = Format.ToString();
+		*File << Magic;
+		*File << FormatName;
+		WrittenSize = File->Tell();
+	}
+
+	virtual void Serialize(void* Data, int64 Length) override
+	{
+		const uint8* Source = static_cast<const uint8*>(Data);
+
+		while (Length > 0)
+		{
+			TArray<uint8>& Chunk        = UncompressedChunks[CurrentChunk];
+			int64          CopiedLength = FMath::Min<int64>(Length, SaveChunkSize - Chunk.Num());
+			Chunk.Append(Source, CopiedLength);
+
+			Source += CopiedLength;
+			Length -= CopiedLength;
+			SerializedSize += CopiedLength;
+
+			if (Chunk.Num() == SaveChunkSize)
+			{
+				CurrentChunk++;
+				if (CurrentChunk == SaveChunkBatchSize)
+				{
+					FlushChunks();
+				}
+			}
+		}
+	}
+
+	virtual FString GetArchiveName() const override
+	{
+		return TEXT("FNovaCompressedSaveWriter");
+	}
+
+	/** Write the pending chunks and the end marker, report stats, return true on success */
+	bool Finalize()
+	{
+		FlushChunks();
+
+		int32 EndMarker = 0;
+		*File << EndMarker;
+		WrittenSize += sizeof(EndMarker);
+
+		int64 PeakBufferSize = 0;
+		for (int32 ChunkIndex = 0; ChunkIndex < SaveChunkBatchSize; ChunkIndex++)
+		{
+			PeakBufferSize += UncompressedChunks[ChunkIndex].GetAllocatedSize() + CompressedChunks[ChunkIndex].GetAllocatedSize();
+		}
+
+		SET_MEMORY_STAT(STAT_NovaSaveSerializedSize, SerializedSize);
+		SET_MEMORY_STAT(STAT_NovaSaveCompressedSize, CompressedSize);
+		SET_MEMORY_STAT(STAT_NovaSaveWrittenSize, WrittenSize);
+		SET_MEMORY_STAT(STAT_NovaSavePeakBufferSize, PeakBufferSize);
+
+		NLOG("FNovaCompressedSaveWriter::Finalize : serialized %lld bytes, compressed to %lld with '%s', wrote %lld using %lld bytes",
+			SerializedSize, CompressedSize, *Format.ToString(), WrittenSize, PeakBufferSize);
+
+		return !IsError() && !File->IsError();
+	}
+
+protected:
+	/** Compress the filled chunks in parallel and write them to the file */
+	void FlushChunks()
+	{
+		const int32 ChunkCount = CurrentChunk + (CurrentChunk < SaveChunkBatchSize && UncompressedChunks[CurrentChunk].Num() > 0 ? 1 : 0);
+
+		ParallelFor(ChunkCount,
+			[&](int32 ChunkIndex)
+			{
+				const TArray<uint8>& Chunk = UncompressedChunks[ChunkIndex];
+				CompressedChunkSizes[ChunkIndex] = CompressedChunks[ChunkIndex].Num();
+
+				if (!FCompression::CompressMemory(Format, CompressedChunks[ChunkIndex].GetData(), CompressedChunkSizes[ChunkIndex],
+						Chunk.GetData(), Chunk.Num(), Flags))
+				{
+					CompressedChunkSizes[ChunkIndex] = INDEX_NONE;
+				}
+			});
+
+		for (int32 ChunkIndex = 0; ChunkIndex < ChunkCount; ChunkIndex++)
+		{
+			int32 ChunkUncompressedSize = UncompressedChunks[ChunkIndex].Num();
+			int32 ChunkCompressedSize   = CompressedChunkSizes[ChunkIndex];
+
+			if (ChunkCompressedSize != INDEX_NONE)
+			{
+				*File << ChunkUncompressedSize;
+				*File << ChunkCompressedSize;
+				File->Serialize(CompressedChunks[ChunkIndex].GetData(), ChunkCompressedSize);
+
+				CompressedSize += ChunkCompressedSize;
+				WrittenSize += 2 * sizeof(int32) + ChunkCompressedSize;
+			}
+			else
+			{
+				NERR("FNovaCompressedSaveWriter::FlushChunks : failed to compress data");
+				SetError();
+			}
+
+			UncompressedChunks[ChunkIndex].Reset();
+		}
+
+		CurrentChunk = 0;
+	}
+
+protected:
+	// Output
+	FArchive*         File;
+	FName             Format;
+	ECompressionFlags Flags;
+
+	// Buffers
+	TArray<TArray<uint8>> UncompressedChunks;
+	TArray<TArray<uint8>> CompressedChunks;
+	TArray<int32>         CompressedChunkSizes;
+	int32                 CurrentChunk;
+
+	// Stats
+	int64 SerializedSize;
+	int64 CompressedSize;
+	int64 WrittenSize;
+};
+
+/** Uncompress a save file, either streamed in chunks or written as a single block by older versions */
+static bool UncompressSaveData(const TArray<uint8>& CompressedData, TArray<uint8>& Result)
+{
+	FMemoryReader Reader(CompressedData);
+
+	uint32 Magic = 0;
+	Reader << Magic;
+
+	// Chunked file : build the chunk table, then decompress all chunks in parallel
+	if (Magic == ChunkedSaveMagic || Magic == ZlibChunkedSaveMagic)
+	{
+		struct FNovaSaveChunk
+		{
+			int64 CompressedOffset;
+			int32 CompressedSize;
+			int64 UncompressedOffset;
+			int32 UncompressedSize;
+		};
+
+		FString FormatName = NAME_Zlib.ToString();
+		if (Magic == ChunkedSaveMagic)
+		{
+			Reader << FormatName;
+		}
+		const FName Format = *FormatName;
+		if (Reader.IsError() || !FCompression::IsFormatValid(Format))
+		{
+			NERR("UncompressSaveData : unsupported compression format '%s'", *FormatName);
+			return false;
+		}
+
+		TArray<FNovaSaveChunk> Chunks;
+		int64                  TotalUncompressedSize = 0;
+		while (true)
+		{
+			FNovaSaveChunk Chunk;
+			Reader << Chunk.UncompressedSize;
+			if (Reader.IsError() || Chunk.UncompressedSize <= 0)
+			{
+				break;
+			}
+			Reader << Chunk.CompressedSize;
+
+			Chunk.CompressedOffset   = Reader.Tell();
+			Chunk.UncompressedOffset = TotalUncompressedSize;
+			if (Reader.IsError() || Chunk.UncompressedSize > SaveChunkSize || Chunk.CompressedSize <= 0 ||
+				Chunk.CompressedOffset + Chunk.CompressedSize > CompressedData.Num())
+			{
+				NERR("UncompressSaveData : corrupted chunk table");
+				return false;
+			}
+
+			Chunks.Add(Chunk);
+			TotalUncompressedSize += Chunk.UncompressedSize;
+			Reader.Seek(Chunk.CompressedOffset + Chunk.CompressedSize);
+		}
+
+		if (Reader.IsError() || TotalUncompressedSize > MAX_int32)
+		{
+			NERR("UncompressSaveData : missing end marker");
+			return false;
+		}
+
+		Result.SetNumUninitialized(TotalUncompressedSize);
+		TAtomic<bool> Success(true);
+		ParallelFor(Chunks.Num(),
+			[&](int32 ChunkIndex)
+			{
+				const FNovaSaveChunk& Chunk = Chunks[ChunkIndex];
+				if (!FCompression::UncompressMemory(Format, Result.GetData() + Chunk.UncompressedOffset, Chunk.UncompressedSize,
+						CompressedData.GetData() + Chunk.CompressedOffset, Chunk.CompressedSize))
+				{
+					Success = false;
+				}
+			});
+
+		if (!Success)
+		{
+			NERR("UncompressSaveData : failed to uncompress chunked data");
+		}
+
+		return Success;
+	}
+
+	// Single block with the uncompressed size stored first
+	else if (CompressedData.Num() > 4)
+	{
+		int32 UncompressedSize = (CompressedData[0] << 24) + (CompressedData[1] << 16) + (CompressedData[2] << 8) + CompressedData[3];
+		if (UncompressedSize <= 0 || UncompressedSize > (CompressedData.Num() - 4) * MaxSaveCompressionRatio)
+		{
+			NERR("UncompressSaveData : invalid uncompressed size %d for compressed size %d", UncompressedSize, CompressedData.Num());
+			return false;
+		}
+
+		Result.SetNum(UncompressedSize);
+
+		if (FCompression::UncompressMemory(
+				NAME_Zlib, Result.GetData(), UncompressedSize, CompressedData.GetData() + 4, CompressedData.Num() - 4))
+		{
+			return true;
+		}
+
+		NERR("UncompressSaveData : failed to uncompress with compressed size %d and uncompressed size %d", CompressedData.Num(),
+			UncompressedSize);
+	}
+
+	return false;
+}
+
+/** Archive computing the CRC of serialized data, optionally forwarding it to another archive */
+class FNovaSaveCrcArchive : public FArchive
+{
+public:
+	FNovaSaveCrcArchive(FArchive* InnerArchive = nullptr) : Inner(InnerArchive), Crc(0)
+	{
+		SetIsSaving(true);
+		SetIsPersistent(true);
+	}
+
+	virtual void Serialize(void* Data, int64 Length) override
+	{
+		Crc = FCrc::MemCrc32(Data, Length, Crc);
+
+		if (Inner)
+		{
+			Inner->Serialize(Data, Length);
+		}
+	}
+
+	virtual FString GetArchiveName() const override
+	{
+		return TEXT("FNovaSaveCrcArchive");
+	}
+
+	uint32 GetCrc() const
+	{
+		return Crc;
+	}
+
+protected:
+	FArchive* Inner;
+	uint32    Crc;
+};
+
+/** Archive replacing asset references with indices into a table of unique assets */
+class FNovaSaveAssetArchive : public FArchive
+{
+public:
+	/** Build an archive that writes indices to an inner archive, or only collects assets when there is none */
+	FNovaSaveAssetArchive(FArchive* InnerArchive, TMap<const UObject*, int32>& Indices, TArray<FGuid>& Identifiers)
+		: Inner(InnerArchive), AssetIndices(&Indices), AssetIdentifiers(&Identifiers), Assets(nullptr)
+	{
+		SetIsSaving(true);
+		SetIsPersistent(true);
+	}
+
+	/** Build an archive that reads indices from an inner archive, or identifiers stored inline by version 1 without a table */
+	FNovaSaveAssetArchive(FArchive* InnerArchive, const TArray<const UNovaAssetDescription*>* LoadedAssets)
+		: Inner(InnerArchive), AssetIndices(nullptr), AssetIdentifiers(nullptr), Assets(LoadedAssets)
+	{
+		SetIsLoading(true);
+		SetIsPersistent(true);
+	}
+
+	virtual void Serialize(void* Data, int64 Length) override
+	{
+		if (Inner)
+		{
+			Inner->Serialize(Data, Length);
+			if (Inner->IsError())
+			{
+				SetError();
+			}
+		}
+	}
+
+	virtual FArchive& operator<<(UObject*& Object) override
+	{
+		int32 Index = INDEX_NONE;
+
+		if (IsLoading() && Assets == nullptr)
+		{
+			FGuid Identifier;
+			*this << Identifier;
+			Object = Identifier.IsValid() ? const_cast<UNovaAssetDescription*>(UNovaAssetManager::Get()->GetAsset(Identifier)) : nullptr;
+		}
+		else if (IsLoading())
+		{
+			*this << Index;
+			Object = Assets->IsValidIndex(Index) ? const_cast<UNovaAssetDescription*>((*Assets)[Index]) : nullptr;
+		}
+		else if (Object)
+		{
+			const UNovaAssetDescription* Asset = Cast<UNovaAssetDescription>(Object);
+			NCHECK(Asset);
+
+			// Only the collecting pass can extend the table, since it's written before the data
+			const int32* ExistingIndex = AssetIndices->Find(Asset);
+			if (ExistingIndex)
+			{
+				Index = *ExistingIndex;
+			}
+			else if (Inner == nullptr)
+			{
+				Index = AssetIdentifiers->Add(Asset->Identifier);
+				AssetIndices->Add(Asset, Index);
+			}
+			else
+			{
+				NERR("FNovaSaveAssetArchive : asset '%s' missing from the table", *Asset->GetName());
+			}
+
+			*this << Index;
+		}
+		else
+		{
+			*this << Index;
+		}
+
+		return *this;
+	}
+
+	virtual int64 TotalSize() override
+	{
+		return Inner ? Inner->TotalSize() : INDEX_NONE;
+	}
+
+	virtual int64 Tell() override
+	{
+		return Inner ? Inner->Tell() : INDEX_NONE;
+	}
+
+	virtual FString GetArchiveName() const override
+	{
+		return TEXT("FNovaSaveAssetArchive");
+	}
+
+protected:
+	FArchive*                                   Inner;
+	TMap<const UObject*, int32>*                AssetIndices;
+	TArray<FGuid>*                              AssetIdentifiers;
+	const TArray<const UNovaAssetDescription*>* Assets;
+};
+
+/** Write or read the summary of a save slot, returns false on unsupported or corrupted data */
+static bool SerializeMetadata(FNovaSaveMetadata& Metadata, FArchive& Ar)
+{
+	uint32 Magic = MetadataSaveMagic;
+	Metadata.Version = BinarySaveVersion;
+	Ar << Magic;
+	Ar << Metadata.Version;
+	if (Ar.IsError() || Magic != MetadataSaveMagic || Metadata.Version > BinarySaveVersion)
+	{
+		return false;
+	}
+
+	int64 Ticks   = Metadata.Timestamp.GetTicks();
+	int64 Credits = Metadata.Credits.GetValue();
+	Ar << Ticks;
+	Ar << Metadata.GameTime;
+	Ar << Credits;
+	Ar << Metadata.SpacecraftName;
+
+	FGuid AreaIdentifier = (Ar.IsSaving() && Metadata.CurrentArea) ? Metadata.CurrentArea->Identifier : FGuid();
+	Ar << AreaIdentifier;
+
+	Metadata.Timestamp   = FDateTime(Ticks);
+	Metadata.Credits     = Credits;
+	Metadata.CurrentArea = UNovaAssetManager::Get()->GetAsset<UNovaArea>(AreaIdentifier);
+
+	return !Ar.IsError();
+}
+
+/** Read one journal entry at the reader position, and apply it to the save data if it's complete and valid */
+static bool ApplyJournalEntry(
+	FMemoryReader& Reader, const TArray<uint8>& JournalData, FName Format, uint32 Version, TSharedPtr<FNovaGameSave>& SaveData)
+{
+	// Check the entry integrity
+	int32  EntrySize = 0;
+	uint32 EntryCrc  = 0;
+	Reader << EntrySize;
+	Reader << EntryCrc;
+	if (Reader.IsError() || EntrySize <= 0 || Reader.Tell() + EntrySize > JournalData.Num())
+	{
+		return false;
+	}
+
+	TArray<uint8> Entry(JournalData.GetData() + Reader.Tell(), EntrySize);
+	Reader.Seek(Reader.Tell() + EntrySize);
+	if (FCrc::MemCrc32(Entry.GetData(), EntrySize) != EntryCrc)
+	{
+		return false;
+	}
+
+	// Uncompress all records before applying any of them
+	TArray<TPair<ENovaSaveJournalRecord, TArray<uint8>>> Records;
+	FMemoryReader                                        EntryReader(Entry);
+	uint8                                                RecordCount = 0;
+	EntryReader << RecordCount;
+	for (uint8 Index = 0; Index < RecordCount; Index++)
+	{
+		uint8 Record           = 0;
+		int32 UncompressedSize = 0;
+		int32 CompressedSize   = 0;
+		EntryReader << Record;
+		EntryReader << UncompressedSize;
+		EntryReader << CompressedSize;
+
+		if (EntryReader.IsError() || Record >= static_cast<uint8>(ENovaSaveJournalRecord::Count) || UncompressedSize <= 0 ||
+			CompressedSize <= 0 || EntryReader.Tell() + CompressedSize > EntrySize ||
+			UncompressedSize > CompressedSize * MaxSaveCompressionRatio)
+		{
+			return false;
+		}
+
+		TArray<uint8> RecordData;
+		RecordData.SetNumUninitialized(UncompressedSize);
+		if (!FCompression::UncompressMemory(
+				Format, RecordData.GetData(), UncompressedSize, Entry.GetData() + EntryReader.Tell(), CompressedSize))
+		{
+			return false;
+		}
+		EntryReader.Seek(EntryReader.Tell() + CompressedSize);
+
+		Records.Add(TPair<ENovaSaveJournalRecord, TArray<uint8>>(static_cast<ENovaSaveJournalRecord>(Record), MoveTemp(RecordData)));
+	}
+
+	// Replace complete sections, or update the general state and AI spacecraft in place
+	for (const TPair<ENovaSaveJournalRecord, TArray<uint8>>& Record : Records)
+	{
+		FMemoryReader RecordReader(Record.Value, true);
+		RecordReader.SetCustomVersion(BinarySaveVersionGuid, Version, TEXT("NovaSave"));
+		switch (Record.Key)
+		{
+			case ENovaSaveJournalRecord::GameStateHeader:
+				UNovaGameInstance::SerializeBinaryGameStateHeader(SaveData, RecordReader);
+				break;
+
+			case ENovaSaveJournalRecord::AISpacecraft:
+				UNovaGameInstance::SerializeBinaryAIDelta(SaveData, TMap<FGuid, uint32>(), RecordReader);
+				break;
+
+			default:
+				UNovaGameInstance::SerializeBinary(SaveData, static_cast<ENovaSaveSection>(Record.Key), RecordReader);
+		}
+
+		if (RecordReader.IsError())
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/** Compress a journal record and append it to an entry, returns false on failure */
+static bool WriteJournalRecord(
+	FArchive& EntryWriter, ENovaSaveJournalRecord Record, const TArray<uint8>& RecordData, FName Format, ECompressionFlags Flags)
+{
+	int32         UncompressedSize = RecordData.Num();
+	int32         CompressedSize   = FCompression::CompressMemoryBound(Format, UncompressedSize, Flags);
+	TArray<uint8> CompressedData;
+	CompressedData.SetNumUninitialized(CompressedSize);
+
+	if (!FCompression::CompressMemory(Format, CompressedData.GetData(), CompressedSize, RecordData.GetData(), UncompressedSize, Flags))
+	{
+		NERR("WriteJournalRecord : failed to compress data");
+		return false;
+	}
+
+	uint8 RecordType = static_cast<uint8>(Record);
+	EntryWriter << RecordType;
+	EntryWriter << UncompressedSize;
+	EntryWriter << CompressedSize;
+	EntryWriter.Serialize(CompressedData.GetData(), CompressedSize);
+
+	return true;
+}
+
+/*----------------------------------------------------
+    Asynchronous tasks
+----------------------------------------------------*/
+
+class FNovaAsyncSave : public FNonAbandonableTask
+{
+	friend class FAutoDeleteAsyncTask<FNovaAsyncSave>;
+
+public:
+	FNovaAsyncSave(UNovaSaveManager* SaveSystemParam, const FString SaveNameParam, const FNovaSaveRequest& RequestParam)
+		: SaveName(SaveNameParam), Request(RequestParam), SaveSystem(SaveSystemParam)
+	{}
+
+protected:
+	void DoWork()
+	{
+		NLOG("FNovaAsyncSave::DoWork : started");
+
+		while (true)
+		{
+			SaveSystem->WriteSave(SaveName, Request);
+
+			// Write the latest snapshot queued during this save, if any, or release the slot
+			SaveSystem->SaveListLock.Lock();
+			bool HasPendingSave = SaveSystem->PendingSaves.RemoveAndCopyValue(SaveName, Request);
+			if (!HasPendingSave)
+			{
+				SaveSystem->SaveList.Remove(SaveName);
+			}
+			SaveSystem->SaveListLock.Unlock();
+
+			if (!HasPendingSave)
+			{
+				break;
+			}
+		}
+
+		NLOG("FNovaAsyncSave::DoWork : done");
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FNovaAsyncSave, STATGROUP_ThreadPoolAsyncTasks);
+	}
+
+protected:
+	FString           SaveName;
+	FNovaSaveRequest  Request;
+	UNovaSaveManager* SaveSystem;
+};
+
+class FNovaAsyncLoad : public FNonAbandonableTask
+{
+	friend class FAutoDeleteAsyncTask<FNovaAsyncLoad>;
+
+public:
+	FNovaAsyncLoad(UNovaSaveManager* SaveSystemParam, const FString SaveNameParam, FNovaGameLoaded CallbackParam)
+		: SaveName(SaveNameParam), SaveSystem(SaveSystemParam), Callback(CallbackParam)
+	{}
+
+protected:
+	void DoWork()
+	{
+		NLOG("FNovaAsyncLoad::DoWork : started");
+
+		TSharedPtr<FNovaGameSave> SaveData = SaveSystem->ReadSaveData(SaveName);
+
+		// Hand the save data over to the game thread
+		UNovaSaveManager* System   = SaveSystem;
+		FNovaGameLoaded   Delegate = Callback;
+		AsyncTask(ENamedThreads::GameThread,
+			[System, Delegate, SaveData]()
+			{
+				Delegate.ExecuteIfBound(SaveData);
+				System->LoadingProgress.Set(INDEX_NONE);
+			});
+
+		NLOG("FNovaAsyncLoad::DoWork : done");
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FNovaAsyncLoad, STATGROUP_ThreadPoolAsyncTasks);
+	}
+
+protected:
+	FString           SaveName;
+	UNovaSaveManager* SaveSystem;
+	FNovaGameLoaded   Callback;
+};
+
+/*----------------------------------------------------
+    Constructor
+----------------------------------------------------*/
+
+UNovaSaveManager::UNovaSaveManager() : Super(), SaveSequence(0)
+{
+	LoadingProgress.Set(INDEX_NONE);
+}
+
+/*----------------------------------------------------
+    Interface
+----------------------------------------------------*/
+
+bool UNovaSaveManager::DoesSaveExist(const FString SaveName)
+{
+	return IFileManager::Get().FileSize(*GetSaveGamePath(SaveName, true)) >= 0 ||
+		   IFileManager::Get().FileSize(*GetSaveGamePath(SaveName, false)) >= 0;
+}
+
+void UNovaSaveManager::SaveGameAsync(
+	const FString SaveName, TSharedPtr<FNovaGameSave> SaveData, bool Compress, ENovaSaveCompression Compression, bool Incremental)
+{
+	NCHECK(SaveData.IsValid());
+
+	SaveListLock.Lock();
+
+	FNovaSaveRequest Request(SaveData, Compress, Compression, Incremental, ++SaveSequence);
+
+	// Only one save per slot is written at a time, the latest snapshot will be written once it's done
+	if (SaveList.Find(SaveName) != INDEX_NONE)
+	{
+		NLOG("UNovaSaveManager::SaveGameAsync : save to '%s' already in progress, queuing", *SaveName);
+		PendingSaves.Add(SaveName, Request);
+		SaveListLock.Unlock();
+		return;
+	}
+	else
+	{
+		SaveList.Add(SaveName);
+		SaveListLock.Unlock();
+	}
+
+	(new FAutoDeleteAsyncTask<FNovaAsyncSave>(this, SaveName, Request))->StartBackgroundTask();
+}
+
+bool UNovaSaveManager::SaveGame(
+	const FString SaveName, TSharedPtr<FNovaGameSave> SaveData, bool Compress, ENovaSaveCompression Compression, bool Incremental)
+{
+	NCHECK(SaveData.IsValid());
+
+	// This save supersedes any snapshot queued for the same slot
+	SaveListLock.Lock();
+	FNovaSaveRequest Request(SaveData, Compress, Compression, Incremental, ++SaveSequence);
+	PendingSaves.Remove(SaveName);
+	SaveListLock.Unlock();
+
+	return WriteSave(SaveName, Request);
+}
+
+void UNovaSaveManager::LoadGameAsync(const FString SaveName, FNovaGameLoaded Callback)
+{
+	NCHECK(!IsLoadingGame());
+
+	LoadingProgress.Set(0);
+
+	(new FAutoDeleteAsyncTask<FNovaAsyncLoad>(this, SaveName, Callback))->StartBackgroundTask();
+}
+
+TSharedPtr<FNovaGameSave> UNovaSaveManager::LoadGame(const FString SaveName)
+{
+	TSharedPtr<FNovaGameSave> SaveData = ReadSaveData(SaveName);
+
+	LoadingProgress.Set(INDEX_NONE);
+
+	return SaveData;
+}
+
+TOptional<float> UNovaSaveManager::GetLoadingProgress() const
+{
+	int32 Progress = LoadingProgress.GetValue();
+
+	return Progress != INDEX_NONE ? TOptional<float>(Progress / 100.0f) : TOptional<float>();
+}
+
+bool UNovaSaveManager::DeleteGame(const FString SaveName)
+{
+	SaveLock.Lock();
+
+	bool Result = IFileManager::Get().Delete(*GetSaveGamePath(SaveName, false), true) |
+				  IFileManager::Get().Delete(*GetSaveGamePath(SaveName, true), true);
+	IFileManager::Get().Delete(*GetSaveJournalPath(SaveName), true);
+	IFileManager::Get().Delete(*GetSaveMetadataPath(SaveName), true);
+	Journals.Remove(SaveName);
+
+	SaveLock.Unlock();
+
+	return Result;
+}
+
+FNovaSaveMetadata UNovaSaveManager::GetSaveMetadata(const FString SaveName) const
+{
+	FNovaSaveMetadata Metadata;
+
+	TArray<uint8> Data;
+	if (FFileHelper::LoadFileToArray(Data, *GetSaveMetadataPath(SaveName), FILEREAD_Silent))
+	{
+		FMemoryReader Reader(Data);
+		if (!SerializeMetadata(Metadata, Reader))
+		{
+			NERR("UNovaSaveManager::GetSaveMetadata : failed to read '%s'", *GetSaveMetadataPath(SaveName));
+			Metadata = FNovaSaveMetadata();
+		}
+	}
+
+	return Metadata;
+}
+
 /*----------------------------------------------------
-    Asynchronous task
+    Helpers
 ----------------------------------------------------*/
 
-class FNovaAsyncSave : public FNonAbandonableTask
+FString UNovaSaveManager::GetSaveGamePath(const FString SaveName, bool Compressed)
 {
-	friend class FAutoDeleteAsyncTask<FNovaAsyncSave>;
+	if (Compressed)
+	{
+		return FString::Printf(TEXT("%s/%s.sav"), *FPaths::ProjectSavedDir(), *SaveName);
+	}
+	else
+	{
+		return FString::Printf(TEXT("%s/%s.json"), *FPaths::ProjectSavedDir(), *SaveName);
+	}
+}
 
-public:
-	FNovaAsyncSave(
-		UNovaSaveManager* SaveSystemParam, const FString SaveNameParam, TSharedPtr<FNovaGameSave> SaveDataParam, bool CompressParam)
-		: SaveName(SaveNameParam), SaveData(SaveDataParam), SaveSystem(SaveSystemParam), Compress(CompressParam)
-	{}
+FString UNovaSaveManager::GetSaveJournalPath(const FString SaveName)
+{
+	return FString::Printf(TEXT("%s/%s.journal"), *FPaths::ProjectSavedDir(), *SaveName);
+}
 
-protected:
-	void DoWork()
+void UNovaSaveManager::SerializeWithAssetTable(FArchive& Ar, TFunctionRef<void(FArchive&)> Serializer)
+{
+	const FCustomVersion* LoadedVersion = Ar.IsLoading() ? Ar.GetCustomVersions().GetVersion(BinarySaveVersionGuid) : nullptr;
+
+	// Version 1 data has no table, with identifiers stored inline
+	if (LoadedVersion && LoadedVersion->Version < 2)
 	{
-		NLOG("FNovaAsyncSave::DoWork : started");
+		FNovaSaveAssetArchive Reader(&Ar, nullptr);
+		Serializer(Reader);
+	}
 
-		SaveSystem->SaveGame(SaveName, SaveData, Compress);
+	// Resolve each asset once, and read the data with indices into the table
+	else if (Ar.IsLoading())
+	{
+		// Read the table by hand so that a corrupted count can't allocate past the data
+		int32 IdentifierCount = 0;
+		Ar << IdentifierCount;
+		if (!IsSerializedCountValid(Ar, IdentifierCount, sizeof(FGuid)))
+		{
+			return;
+		}
 
-		NLOG("FNovaAsyncSave::DoWork : done");
+		TArray<FGuid> Identifiers;
+		Identifiers.SetNum(IdentifierCount);
+		for (FGuid& Identifier : Identifiers)
+		{
+			Ar << Identifier;
+		}
+
+		TArray<const UNovaAssetDescription*> Assets;
+		for (const FGuid& Identifier : Identifiers)
+		{
+			Assets.Add(UNovaAssetManager::Get()->GetAsset(Identifier));
+		}
+
+		FNovaSaveAssetArchive Reader(&Ar, &Assets);
+		Serializer(Reader);
 	}
 
-	FORCEINLINE TStatId GetStatId() const
+	// Collect the assets first so that the table can be written ahead of the data
+	else
 	{
-		RETURN_QUICK_DECLARE_CYCLE_STAT(FNovaAsyncSave, STATGROUP_ThreadPoolAsyncTasks);
+		TMap<const UObject*, int32> Indices;
+		TArray<FGuid>               Identifiers;
+
+		FNovaSaveAssetArchive Collector(nullptr, Indices, Identifiers);
+		Serializer(Collector);
+		Ar << Identifiers;
+
+		FNovaSaveAssetArchive Writer(&Ar, Indices, Identifiers);
+		Serializer(Writer);
+	}
+}
+
+FString UNovaSaveManager::GetSaveMetadataPath(const FString SaveName)
+{
+	return FString::Printf(TEXT("%s/%s.meta"), *FPaths::ProjectSavedDir(), *SaveName);
+}
+
+FString UNovaSaveManager::JsonToString(const TSharedPtr<FJsonObject>& SaveData)
+{
+	FString SerializedSaveData;
+	auto    JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&SerializedSaveData);
+
+	if (!FJsonSerializer::Serialize(SaveData.ToSharedRef(), JsonWriter))
+	{
+		NCHECK(false);
 	}
 
-protected:
-	FString                   SaveName;
-	TSharedPtr<FNovaGameSave> SaveData;
-	UNovaSaveManager*         SaveSystem;
-	bool                      Compress;
-};
+	JsonWriter->Close();
 
-/*----------------------------------------------------
-    Constructor
-----------------------------------------------------*/
+	return SerializedSaveData;
+}
 
-UNovaSaveManager::UNovaSaveManager() : Super()
-{}
+TSharedPtr<FJsonObject> UNovaSaveManager::StringToJson(const FString& SerializedSaveData)
+{
+	TSharedPtr<FJsonObject>   SaveData;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(SerializedSaveData);
 
-/*----------------------------------------------------
-    Interface
-----------------------------------------------------*/
+	if (!FJsonSerializer::Deserialize(Reader, SaveData) || !SaveData.IsValid())
+	{
+		NCHECK(false);
+	}
 
-bool UNovaSaveManager::DoesSaveExist(const FString SaveName)
+	return SaveData;
+}
+
+void UNovaSaveManager::SaveToBinary(TSharedPtr<FNovaGameSave> SaveData, FArchive& Ar)
 {
-	return IFileManager::Get().FileSize(*GetSaveGamePath(SaveName, true)) >= 0 ||
-		   IFileManager::Get().FileSize(*GetSaveGamePath(SaveName, false)) >= 0;
+	uint32 Magic   = BinarySaveMagic;
+	uint32 Version = BinarySaveVersion;
+	Ar << Magic;
+	Ar << Version;
+
+	UNovaGameInstance::SerializeBinary(SaveData, Ar);
 }
 
-void UNovaSaveManager::SaveGameAsync(const FString SaveName, TSharedPtr<FNovaGameSave> SaveData, bool Compress)
+bool UNovaSaveManager::BinaryToSave(const TArray<uint8>& SerializedSaveData, TSharedPtr<FNovaGameSave>& SaveData)
 {
-	NCHECK(SaveData.IsValid());
+	FMemoryReader Reader(SerializedSaveData);
 
-	SaveListLock.Lock();
+	uint32 Magic   = 0;
+	uint32 Version = 0;
+	Reader << Magic;
+	Reader << Version;
 
-	if (SaveList.Find(SaveData) != INDEX_NONE)
+	if (Magic != BinarySaveMagic || Version == 0 || Version > BinarySaveVersion)
 	{
-		NLOG("UNovaSaveManager::SaveGameAsync : save to '%s' already in progress, aborting", *SaveName);
-		SaveListLock.Unlock();
-		return;
+		NERR("UNovaSaveManager::BinaryToSave : unsupported save version %d", Version);
+		return false;
 	}
-	else
+
+	Reader.SetCustomVersion(BinarySaveVersionGuid, Version, TEXT("NovaSave"));
+	UNovaGameInstance::SerializeBinary(SaveData, Reader);
+
+	if (Reader.IsError())
 	{
-		SaveList.Add(SaveData);
-		SaveListLock.Unlock();
+		SaveData.Reset();
+		return false;
 	}
 
-	(new FAutoDeleteAsyncTask<FNovaAsyncSave>(this, SaveName, SaveData, Compress))->StartBackgroundTask();
+	return true;
 }
 
-bool UNovaSaveManager::SaveGame(const FString SaveName, TSharedPtr<FNovaGameSave> SaveData, bool Compress)
+bool UNovaSaveManager::IsBinarySave(const TArray<uint8>& SerializedSaveData)
 {
-	NLOG("UNovaSaveManager::SaveGame : saving to '%s'", *SaveName);
+	uint32 Magic = 0;
+	if (SerializedSaveData.Num() >= sizeof(Magic))
+	{
+		FMemory::Memcpy(&Magic, SerializedSaveData.GetData(), sizeof(Magic));
+	}
 
-	NCHECK(SaveData.IsValid());
+	return Magic == BinarySaveMagic;
+}
 
-	SaveLock.Lock();
+FGuid UNovaSaveManager::DeserializeGuid(const TSharedPtr<FJsonObject>& SaveData, const FString& FieldName)
+{
+	FGuid Identifier;
 
-	// Initialize
-	bool                    Result = false;
-	TSharedPtr<FJsonObject> JsonData;
-	UNovaGameInstance::SerializeJson(SaveData, JsonData, ENovaSerialize::DataToJson);
-	FString FileContents = JsonToString(JsonData);
+	if (SaveData->HasField(FieldName))
+	{
+		FGuid::Parse(SaveData->GetStringField(FieldName), Identifier);
+	}
+
+	return Identifier;
+}
 
-	// Serialize the JSON objects and compress
-	if (Compress)
+/*----------------------------------------------------
+    Internals
+----------------------------------------------------*/
+
+bool UNovaSaveManager::WriteSave(const FString& SaveName, const FNovaSaveRequest& Request)
+{
+	NLOG("UNovaSaveManager::WriteSave : saving to '%s'", *SaveName);
+
+	SaveLock.Lock();
+
+	// Skip snapshots older than what was already written, since worker threads can run in any order
+	int64& WrittenSequence = WrittenSaveSequences.FindOrAdd(SaveName);
+	if (Request.Sequence < WrittenSequence)
 	{
-		// Estimate sizes - 4 bytes to store size, 512 byes of margin for small files with higher compressed sizes
-		uint32 DataSize               = FCStringAnsi::Strlen(TCHAR_TO_UTF8(*FileContents));
-		int32  ContentsCompressedSize = DataSize + 512;
-		int32  FullCompressedSize     = ContentsCompressedSize + 4;
+		NLOG("UNovaSaveManager::WriteSave : newer save already written, skipping");
+		SaveLock.Unlock();
+		return true;
+	}
+	WrittenSequence = Request.Sequence;
 
-		// Allocate a buffer
-		uint8* CompressedData         = new uint8[FullCompressedSize];
-		uint8* CompressedDataContents = CompressedData + 4;
+	// Initialize
+	bool  Result = false;
+	int64 Cycles = FPlatformTime::Cycles64();
 
-		// Write size
-		CompressedData[0] = (DataSize >> 24) & 0xFF;
-		CompressedData[1] = (DataSize >> 16) & 0xFF;
-		CompressedData[2] = (DataSize >> 8) & 0xFF;
-		CompressedData[3] = (DataSize >> 0) & 0xFF;
+	// Append changes to the journal when it matches the full save on disk, or write a full save
+	if (Request.Compress)
+	{
+		FNovaSaveJournalState* Journal = Journals.Find(SaveName);
+		const int64 JournalFileSize    = FMath::Max<int64>(IFileManager::Get().FileSize(*GetSaveJournalPath(SaveName)), 0);
 
-		// Compress contents
-		if (FCompression::CompressMemory(NAME_Zlib, CompressedDataContents, ContentsCompressedSize, TCHAR_TO_UTF8(*FileContents), DataSize))
+		if (Request.Incremental && Journal && Journal->JournalSize == JournalFileSize &&
+			Journal->EntryCount < CVarSaveJournalLength.GetValueOnAnyThread() && Journal->JournalSize < Journal->SnapshotSize)
 		{
-			int32 EffectiveCompressedSize = ContentsCompressedSize + 4;
-			Result                        = FFileHelper::SaveArrayToFile(
-                TArrayView<const uint8>(CompressedData, EffectiveCompressedSize), *GetSaveGamePath(SaveName, true));
+			Result = WriteSaveJournal(SaveName, Request.SaveData, *Journal);
 		}
 		else
 		{
-			NERR("UNovaSaveManager::SaveGame : failed to compress data");
+			Result = WriteFullSave(SaveName, Request.SaveData, Request.Compression);
 		}
+	}
 
-		delete[] CompressedData;
+	// Serialize the JSON objects, either as the save itself or as a debugging export
+	if (!Request.Compress || CVarExportJsonSaves.GetValueOnAnyThread() != 0)
+	{
+		TSharedPtr<FNovaGameSave> SaveData = Request.SaveData;
+		TSharedPtr<FJsonObject>   JsonData;
+		UNovaGameInstance::SerializeJson(SaveData, JsonData, ENovaSerialize::DataToJson);
+		bool JsonResult = FFileHelper::SaveStringToFile(JsonToString(JsonData), *GetSaveGamePath(SaveName, false));
+		Result          = Request.Compress ? Result : JsonResult;
 	}
-	else
+
+	// Write the slot summary
+	FNovaSaveMetadata Metadata = UNovaGameInstance::GetMetadata(Request.SaveData);
+	if (Result && Metadata.IsValid())
 	{
-		Result = FFileHelper::SaveStringToFile(FileContents, *GetSaveGamePath(SaveName, false));
+		TArray<uint8> MetadataData;
+		FMemoryWriter MetadataWriter(MetadataData, true);
+		SerializeMetadata(Metadata, MetadataWriter);
+		Result = FFileHelper::SaveArrayToFile(MetadataData, *GetSaveMetadataPath(SaveName));
 	}
 
-	NLOG("UNovaSaveManager::SaveGame : done with result %d", Result);
+	NLOG("UNovaSaveManager::WriteSave : done with result %d in %.2fms", Result,
+		FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Cycles));
 
 	SaveLock.Unlock();
 
-	// Pop the request from the list
-	SaveListLock.Lock();
-	SaveList.Remove(SaveData);
-	SaveListLock.Unlock();
-
 	return Result;
 }
 
-TSharedPtr<FNovaGameSave> UNovaSaveManager::LoadGame(const FString SaveName)
+TSharedPtr<FNovaGameSave> UNovaSaveManager::ReadSaveData(const FString SaveName)
 {
-	FString SaveString;
-	bool    SaveStringLoaded = false;
+	TSharedPtr<FNovaGameSave> SaveData;
+	TSharedPtr<FJsonObject>   JsonData;
+	int64                     Cycles = FPlatformTime::Cycles64();
 
 	if (DoesSaveExist(SaveName))
 	{
-		NLOG("UNovaSaveManager::LoadGame : loading from '%s'", *SaveName);
+		NLOG("UNovaSaveManager::ReadSaveData : loading from '%s'", *SaveName);
 
+		// Read the file, with compressed files holding either binary data or JSON from older versions
+		TArray<uint8> CompressedData;
 		TArray<uint8> Data;
-
-		auto LoadCompressedFileToString = [&](FString& Result, const TCHAR* Filename)
+		FString       SaveString;
+		if (FFileHelper::LoadFileToArray(CompressedData, *GetSaveGamePath(SaveName, true), FILEREAD_Silent))
 		{
-			TArray<uint8> CompressedData;
-			if (!FFileHelper::LoadFileToArray(CompressedData, Filename))
-			{
-				NLOG("UNovaSaveManager::LoadGame : no compressed save file found");
-				return false;
-			}
+			NLOG("UNovaSaveManager::ReadSaveData : read '%s'", *GetSaveGamePath(SaveName, true));
+			LoadingProgress.Set(40);
 
-			// Read uncompressed size
-			int32 UncompressedSize = (CompressedData[0] << 24) + (CompressedData[1] << 16) + (CompressedData[2] << 8) + CompressedData[3];
-			Data.SetNum(UncompressedSize + 1);
-
-			// Uncompress
-			if (!FCompression::UncompressMemory(
-					NAME_Zlib, Data.GetData(), UncompressedSize, CompressedData.GetData() + 4, CompressedData.Num() - 4))
+			if (UncompressSaveData(CompressedData, Data))
 			{
-				NERR("UNovaSaveManager::LoadGame : failed to uncompress with compressed size %d and uncompressed size %d",
-					CompressedData.Num(), UncompressedSize);
-				return false;
-			}
-
-			// Convert to string
-			Data[UncompressedSize] = 0;
-			Result                 = UTF8_TO_TCHAR(Data.GetData());
-			return true;
-		};
+				CompressedData.Empty();
+				LoadingProgress.Set(60);
 
-		// Check which file to load
-		if (LoadCompressedFileToString(SaveString, *GetSaveGamePath(SaveName, true)))
-		{
-			NLOG("UNovaSaveManager::LoadGame : read '%s'", *GetSaveGamePath(SaveName, true));
-			SaveStringLoaded = true;
+				if (IsBinarySave(Data))
+				{
+					if (BinaryToSave(Data, SaveData))
+					{
+						LoadingProgress.Set(90);
+						LoadSaveJournal(SaveName, Data, SaveData);
+					}
+					else
+					{
+						NERR("UNovaSaveManager::ReadSaveData : failed to read binary save data");
+					}
+				}
+				else
+				{
+					FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Data.GetData()), Data.Num());
+					JsonData = StringToJson(FString(Converter.Length(), Converter.Get()));
+				}
+			}
 		}
 		else if (FFileHelper::LoadFileToString(SaveString, *GetSaveGamePath(SaveName, false)))
 		{
-			NLOG("UNovaSaveManager::LoadGame : read '%s'", *GetSaveGamePath(SaveName, false));
-			SaveStringLoaded = true;
+			NLOG("UNovaSaveManager::ReadSaveData : read '%s'", *GetSaveGamePath(SaveName, false));
+			LoadingProgress.Set(40);
+
+			JsonData = StringToJson(SaveString);
+			LoadingProgress.Set(60);
 		}
 	}
 
-	// Get JSON data from the save string
-	TSharedPtr<FNovaGameSave> SaveData;
-	TSharedPtr<FJsonObject>   JsonData;
-	if (SaveStringLoaded)
-	{
-		JsonData = StringToJson(SaveString);
-	}
-	else
+	// Deserialize the JSON object, or start from scratch
+	if (!SaveData.IsValid())
 	{
-		NLOG("UNovaSaveManager::LoadGame : failed to read either '%s' or '%s'", *GetSaveGamePath(SaveName, true),
-			*GetSaveGamePath(SaveName, false));
+		if (!JsonData.IsValid())
+		{
+			NLOG("UNovaSaveManager::ReadSaveData : failed to read either '%s' or '%s'", *GetSaveGamePath(SaveName, true),
+				*GetSaveGamePath(SaveName, false));
+
+			JsonData = MakeShared<FJsonObject>();
+		}
 
-		JsonData = MakeShared<FJsonObject>();
+		UNovaGameInstance::SerializeJson(SaveData, JsonData, ENovaSerialize::JsonToData);
 	}
 
-	// Deserialize the JSON object
-	UNovaGameInstance::SerializeJson(SaveData, JsonData, ENovaSerialize::JsonToData);
+	LoadingProgress.Set(100);
+
+	NLOG("UNovaSaveManager::ReadSaveData : done in %.2fms", FPlatformTime::ToMilliseconds(FPlatformTime::Cycles64() - Cycles));
+
 	return SaveData;
 }
 
-bool UNovaSaveManager::DeleteGame(const FString SaveName)
+bool UNovaSaveManager::WriteFullSave(const FString& SaveName, TSharedPtr<FNovaGameSave> SaveData, ENovaSaveCompression Compression)
 {
-	bool Result = IFileManager::Get().Delete(*GetSaveGamePath(SaveName, false), true) |
-				  IFileManager::Get().Delete(*GetSaveGamePath(SaveName, true), true);
-	return Result;
-}
+	const FString SavePath      = GetSaveGamePath(SaveName, true);
+	const FString TemporaryPath = SavePath + TEXT(".tmp");
+	bool          Result        = false;
 
-/*----------------------------------------------------
-    Helpers
-----------------------------------------------------*/
+	// Stream the binary data through the compressor to a temporary file, and replace the save once complete
+	FNovaSaveJournalState Journal;
+	TUniquePtr<FArchive>  FileWriter(IFileManager::Get().CreateFileWriter(*TemporaryPath));
+	if (FileWriter.IsValid())
+	{
+		FNovaCompressedSaveWriter Writer(FileWriter.Get(), Compression);
+		FNovaSaveCrcArchive       SnapshotArchive(&Writer);
+		SaveToBinary(SaveData, SnapshotArchive);
+		Result = Writer.Finalize() && FileWriter->Close();
+		FileWriter.Reset();
 
-FString UNovaSaveManager::GetSaveGamePath(const FString SaveName, bool Compressed)
-{
-	if (Compressed)
+		Result              = Result && IFileManager::Get().Move(*SavePath, *TemporaryPath, true, true);
+		Journal.SnapshotCrc = SnapshotArchive.GetCrc();
+	}
+	else
 	{
-		return FString::Printf(TEXT("%s/%s.sav"), *FPaths::ProjectSavedDir(), *SaveName);
+		NERR("UNovaSaveManager::WriteFullSave : failed to open '%s'", *TemporaryPath);
+	}
+
+	// The journal is now obsolete, future incremental saves will start a new one
+	IFileManager::Get().Delete(*GetSaveJournalPath(SaveName), true);
+	if (Result)
+	{
+		Journal.SnapshotSize = IFileManager::Get().FileSize(*SavePath);
+		UNovaGameInstance::GetAIRevisions(SaveData, Journal.AIRevisions);
+		Journals.Add(SaveName, Journal);
 	}
 	else
 	{
-		return FString::Printf(TEXT("%s/%s.json"), *FPaths::ProjectSavedDir(), *SaveName);
+		Journals.Remove(SaveName);
 	}
+
+	return Result;
 }
 
-FString UNovaSaveManager::JsonToString(const TSharedPtr<FJsonObject>& SaveData)
+bool UNovaSaveManager::WriteSaveJournal(const FString& SaveName, TSharedPtr<FNovaGameSave> SaveData, FNovaSaveJournalState& Journal)
 {
-	FString SerializedSaveData;
-	auto    JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&SerializedSaveData);
+	const FString JournalPath = GetSaveJournalPath(SaveName);
 
-	if (!FJsonSerializer::Serialize(SaveData.ToSharedRef(), JsonWriter))
+	ECompressionFlags Flags;
+	const FName       Format = GetCompressionFormat(ENovaSaveCompression::Fast, Flags);
+
+	// Write the small sections and general state every time, but only the AI spacecraft whose revision changed
+	TArray<uint8> Entry;
+	FMemoryWriter EntryWriter(Entry, true);
+	uint8         RecordCount = 0;
+	EntryWriter << RecordCount;
+	for (ENovaSaveJournalRecord Record : {ENovaSaveJournalRecord::Player, ENovaSaveJournalRecord::ContractManager,
+			 ENovaSaveJournalRecord::GameStateHeader, ENovaSaveJournalRecord::AISpacecraft})
 	{
-		NCHECK(false);
+		TArray<uint8> RecordData;
+		FMemoryWriter RecordWriter(RecordData, true);
+		switch (Record)
+		{
+			case ENovaSaveJournalRecord::GameStateHeader:
+				UNovaGameInstance::SerializeBinaryGameStateHeader(SaveData, RecordWriter);
+				break;
+
+			case ENovaSaveJournalRecord::AISpacecraft:
+				if (UNovaGameInstance::SerializeBinaryAIDelta(SaveData, Journal.AIRevisions, RecordWriter) == 0)
+				{
+					continue;
+				}
+				break;
+
+			default:
+				UNovaGameInstance::SerializeBinary(SaveData, static_cast<ENovaSaveSection>(Record), RecordWriter);
+		}
+
+		if (!WriteJournalRecord(EntryWriter, Record, RecordData, Format, Flags))
+		{
+			return false;
+		}
+		RecordCount++;
 	}
+	Entry[0] = RecordCount;
 
-	JsonWriter->Close();
+	// Start a new journal after a full save, or append to the existing one
+	TUniquePtr<FArchive> FileWriter(
+		IFileManager::Get().CreateFileWriter(*JournalPath, Journal.EntryCount > 0 ? FILEWRITE_Append : FILEWRITE_None));
+	if (!FileWriter.IsValid())
+	{
+		NERR("UNovaSaveManager::WriteSaveJournal : failed to open '%s'", *JournalPath);
+		return false;
+	}
 
-	return SerializedSaveData;
-}
+	if (Journal.EntryCount == 0)
+	{
+		uint32  Magic      = JournalSaveMagic;
+		uint32  Version    = BinarySaveVersion;
+		FString FormatName = Format.ToString();
+		*FileWriter << Magic;
+		*FileWriter << Version;
+		*FileWriter << FormatName;
+		*FileWriter << Journal.SnapshotCrc;
+	}
 
-TSharedPtr<FJsonObject> UNovaSaveManager::StringToJson(const FString& SerializedSaveData)
-{
-	TSharedPtr<FJsonObject>   SaveData;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(SerializedSaveData);
+	int32  EntrySize = Entry.Num();
+	uint32 EntryCrc  = FCrc::MemCrc32(Entry.GetData(), EntrySize);
+	*FileWriter << EntrySize;
+	*FileWriter << EntryCrc;
+	FileWriter->Serialize(Entry.GetData(), EntrySize);
 
-	if (!FJsonSerializer::Deserialize(Reader, SaveData) || !SaveData.IsValid())
+	bool Result = !FileWriter->IsError() && FileWriter->Close();
+	FileWriter.Reset();
+
+	// Track the new state, or trigger a full save next time if the entry might be incomplete
+	if (Result)
 	{
-		NCHECK(false);
+		UNovaGameInstance::GetAIRevisions(SaveData, Journal.AIRevisions);
+		Journal.EntryCount++;
+		Journal.JournalSize = IFileManager::Get().FileSize(*JournalPath);
+	}
+	else
+	{
+		Journal.JournalSize = INDEX_NONE;
 	}
 
-	return SaveData;
+	NLOG("UNovaSaveManager::WriteSaveJournal : wrote %d records in %d bytes, entry %d", RecordCount, EntrySize, Journal.EntryCount);
+
+	return Result;
 }
 
-FGuid UNovaSaveManager::DeserializeGuid(const TSharedPtr<FJsonObject>& SaveData, const FString& FieldName)
+void UNovaSaveManager::LoadSaveJournal(const FString& SaveName, const TArray<uint8>& SnapshotData, TSharedPtr<FNovaGameSave>& SaveData)
 {
-	FGuid Identifier;
+	FNovaSaveJournalState Journal;
+	Journal.SnapshotCrc  = FCrc::MemCrc32(SnapshotData.GetData(), SnapshotData.Num());
+	Journal.SnapshotSize = IFileManager::Get().FileSize(*GetSaveGamePath(SaveName, true));
+	bool CanAppend       = true;
 
-	if (SaveData->HasField(FieldName))
+	TArray<uint8> JournalData;
+	if (FFileHelper::LoadFileToArray(JournalData, *GetSaveJournalPath(SaveName), FILEREAD_Silent))
 	{
-		FGuid::Parse(SaveData->GetStringField(FieldName), Identifier);
+		FMemoryReader Reader(JournalData);
+
+		uint32  Magic       = 0;
+		uint32  Version     = 0;
+		uint32  SnapshotCrc = 0;
+		FString FormatName;
+		Reader << Magic;
+		Reader << Version;
+		const bool IsSupportedVersion = Version > 0 && Version <= BinarySaveVersion;
+		if (Magic == JournalSaveMagic && IsSupportedVersion)
+		{
+			Reader << FormatName;
+			Reader << SnapshotCrc;
+		}
+
+		// A journal left over from an older full save is ignored, and will be replaced on the next incremental save
+		const FName Format = *FormatName;
+		if (Reader.IsError() || Magic != JournalSaveMagic || !IsSupportedVersion || SnapshotCrc != Journal.SnapshotCrc ||
+			!FCompression::IsFormatValid(Format))
+		{
+			NLOG("UNovaSaveManager::LoadSaveJournal : ignoring outdated journal");
+		}
+
+		// Apply all complete entries, an interrupted write will be compacted on the next save
+		else
+		{
+			while (!Reader.AtEnd())
+			{
+				if (!ApplyJournalEntry(Reader, JournalData, Format, Version, SaveData))
+				{
+					NERR("UNovaSaveManager::LoadSaveJournal : stopped at invalid entry %d", Journal.EntryCount);
+					CanAppend = false;
+					break;
+				}
+
+				Journal.EntryCount++;
+			}
+
+			Journal.JournalSize = JournalData.Num();
+
+			// Journals from older versions are compacted into a full save rather than extended
+			if (Version != BinarySaveVersion)
+			{
+				CanAppend = false;
+			}
+
+			NLOG("UNovaSaveManager::LoadSaveJournal : applied %d entries", Journal.EntryCount);
+		}
 	}
 
-	return Identifier;
+	// Store the AI revisions to compare the next incremental save against
+	UNovaGameInstance::GetAIRevisions(SaveData, Journal.AIRevisions);
+
+	SaveLock.Lock();
+	if (CanAppend)
+	{
+		Journals.Add(SaveName, Journal);
+	}
+	else
+	{
+		Journals.Remove(SaveName);
+	}
+	SaveLock.Unlock();
 }
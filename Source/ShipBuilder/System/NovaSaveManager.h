@@ -3,8 +3,70 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "Game/NovaGameTypes.h"
+
 #include "NovaSaveManager.generated.h"
 
+/** Callback for asynchronous loads, called on the game thread */
+DECLARE_DELEGATE_OneParam(FNovaGameLoaded, TSharedPtr<struct FNovaGameSave>);
+
+/** Compression tradeoff for a save, between fast autosaves and compact full saves */
+enum class ENovaSaveCompression : uint8
+{
+	Fast,
+	Default
+};
+
+/** Summary of a save slot, stored next to the save so that it can be listed without loading it */
+struct FNovaSaveMetadata
+{
+	FNovaSaveMetadata() : Version(0), CurrentArea(nullptr)
+	{}
+
+	bool IsValid() const
+	{
+		return Timestamp.GetTicks() > 0;
+	}
+
+	uint32                 Version;
+	FDateTime              Timestamp;
+	FNovaTime              GameTime;
+	FNovaCredits           Credits;
+	FString                SpacecraftName;
+	const class UNovaArea* CurrentArea;
+};
+
+/** Save of an immutable game snapshot to a slot */
+struct FNovaSaveRequest
+{
+	FNovaSaveRequest() : Compress(true), Compression(ENovaSaveCompression::Default), Incremental(false), Sequence(0)
+	{}
+
+	FNovaSaveRequest(TSharedPtr<struct FNovaGameSave> Data, bool C, ENovaSaveCompression Comp, bool I, int64 S)
+		: SaveData(Data), Compress(C), Compression(Comp), Incremental(I), Sequence(S)
+	{}
+
+	TSharedPtr<struct FNovaGameSave> SaveData;
+	bool                             Compress;
+	ENovaSaveCompression             Compression;
+	bool                             Incremental;
+	int64                            Sequence;
+};
+
+/** State of the delta journal written against the last full save of a slot */
+struct FNovaSaveJournalState
+{
+	FNovaSaveJournalState() : SnapshotCrc(0), SnapshotSize(0), JournalSize(0), EntryCount(0)
+	{}
+
+	uint32              SnapshotCrc;
+	int64               SnapshotSize;
+	int64               JournalSize;
+	int32               EntryCount;
+	TMap<FGuid, uint32> AIRevisions;
+};
+
 /** Game interface to load and write saves */
 UCLASS(ClassGroup = (Nova))
 class UNovaSaveManager : public UObject
@@ -14,6 +76,9 @@ class UNovaSaveManager : public UObject
 public:
 	UNovaSaveManager();
 
+	friend class FNovaAsyncSave;
+	friend class FNovaAsyncLoad;
+
 	/*----------------------------------------------------
 	    Interface
 	----------------------------------------------------*/
@@ -21,18 +86,36 @@ public:
 	/** Confirm if a save slot does exist */
 	bool DoesSaveExist(const FString SaveName);
 
-	/** Start an asynchronous process to save data */
-	void SaveGameAsync(const FString SaveName, TSharedPtr<struct FNovaGameSave> SaveData, bool Compress = true);
+	/** Start an asynchronous process to save data, which must not be modified afterwards */
+	void SaveGameAsync(const FString SaveName, TSharedPtr<struct FNovaGameSave> SaveData, bool Compress = true,
+		ENovaSaveCompression Compression = ENovaSaveCompression::Default, bool Incremental = false);
+
+	/** Serialize and save a game state structure synchronously to the filesystem, as compressed binary or plain JSON.
+	 * Incremental saves only append the changed sections to a journal, until it's compacted into a full save. */
+	bool SaveGame(const FString SaveName, TSharedPtr<struct FNovaGameSave> SaveData, bool Compress = true,
+		ENovaSaveCompression Compression = ENovaSaveCompression::Default, bool Incremental = false);
 
-	/** Serialize and save a game state structure synchronously to the filesystem with optional compression */
-	bool SaveGame(const FString SaveName, TSharedPtr<struct FNovaGameSave> SaveData, bool Compress = true);
+	/** Start loading a game state structure in the background, with only the callback running on the game thread */
+	void LoadGameAsync(const FString SaveName, FNovaGameLoaded Callback);
 
 	/** Load a game state structure synchronously from the filesystem */
 	TSharedPtr<struct FNovaGameSave> LoadGame(const FString SaveName);
 
+	/** Check whether an asynchronous load is in progress */
+	bool IsLoadingGame() const
+	{
+		return LoadingProgress.GetValue() != INDEX_NONE;
+	}
+
+	/** Get the progress of the current load between 0 and 1, if any */
+	TOptional<float> GetLoadingProgress() const;
+
 	/** Delete a game save */
 	bool DeleteGame(const FString SaveName);
 
+	/** Read the summary of a save slot without loading the save itself */
+	FNovaSaveMetadata GetSaveMetadata(const FString SaveName) const;
+
 public:
 	/*----------------------------------------------------
 	    Helpers
@@ -41,22 +124,70 @@ public:
 	/** Get the path to save game file for the given name */
 	static FString GetSaveGamePath(const FString SaveName, bool Compressed);
 
+	/** Get the path to the delta journal for the given name */
+	static FString GetSaveJournalPath(const FString SaveName);
+
+	/** Get the path to the slot summary for the given name */
+	static FString GetSaveMetadataPath(const FString SaveName);
+
 	/** Serialize a save data object into a string */
 	static FString JsonToString(const TSharedPtr<class FJsonObject>& SaveData);
 
 	/** Deserialize a string into a save data object */
 	static TSharedPtr<class FJsonObject> StringToJson(const FString& SerializedSaveData);
 
+	/** Serialize a save data object into a versioned binary archive */
+	static void SaveToBinary(TSharedPtr<struct FNovaGameSave> SaveData, FArchive& Ar);
+
+	/** Run a binary serializer with asset references stored once in a table ahead of the data, and referenced by index.
+	 * Version 1 data being loaded has no table, with identifiers stored inline instead. */
+	static void SerializeWithAssetTable(FArchive& Ar, TFunctionRef<void(FArchive&)> Serializer);
+
+	/** Deserialize a versioned binary buffer into a save data object, returns false on unsupported or corrupted data */
+	static bool BinaryToSave(const TArray<uint8>& SerializedSaveData, TSharedPtr<struct FNovaGameSave>& SaveData);
+
+	/** Check whether a buffer holds a binary save rather than JSON */
+	static bool IsBinarySave(const TArray<uint8>& SerializedSaveData);
+
 	/** De-serialize an FGuid description into an asset pointer */
 	static FGuid DeserializeGuid(const TSharedPtr<class FJsonObject>& SaveData, const FString& FieldName);
 
+protected:
+	/*----------------------------------------------------
+	    Internals
+	----------------------------------------------------*/
+
+	/** Write a save request unless a more recent one was already written to the same slot */
+	bool WriteSave(const FString& SaveName, const FNovaSaveRequest& Request);
+
+	/** Read, uncompress and deserialize a save, reporting progress along the way */
+	TSharedPtr<struct FNovaGameSave> ReadSaveData(const FString SaveName);
+
+	/** Write a complete compressed save and reset its journal */
+	bool WriteFullSave(const FString& SaveName, TSharedPtr<struct FNovaGameSave> SaveData, ENovaSaveCompression Compression);
+
+	/** Append the general state, small sections and AI spacecraft that changed since the last save to the journal */
+	bool WriteSaveJournal(const FString& SaveName, TSharedPtr<struct FNovaGameSave> SaveData, FNovaSaveJournalState& Journal);
+
+	/** Apply the journal of a slot to the save data loaded from its full save */
+	void LoadSaveJournal(const FString& SaveName, const TArray<uint8>& SnapshotData, TSharedPtr<struct FNovaGameSave>& SaveData);
+
 	/*----------------------------------------------------
 	    Data
 	----------------------------------------------------*/
 
 protected:
-	// Prepared game save data
-	TArray<TSharedPtr<struct FNovaGameSave>> SaveList;
+	// Slots with a save in progress, latest snapshot queued for each, and ordering of save requests
+	TArray<FString>                 SaveList;
+	TMap<FString, FNovaSaveRequest> PendingSaves;
+	TMap<FString, int64>            WrittenSaveSequences;
+	int64                           SaveSequence;
+
+	// Journal state for each slot saved or loaded during this session
+	TMap<FString, FNovaSaveJournalState> Journals;
+
+	// Progress of the current load in percent, or INDEX_NONE
+	FThreadSafeCounter LoadingProgress;
 
 	// Critical sections
 	FCriticalSection SaveLock;
@@ -168,6 +168,45 @@ bool UNovaSessionsManager::StartSession(FString URL, int32 MaxNumPlayers, bool P
 	return false;
 }
 
+bool UNovaSessionsManager::StartDedicatedSession(FString URL, int32 MaxNumPlayers)
+{
+	NLOG("UNovaSessionsManager::StartDedicatedSession");
+
+	NCHECK(IsRunningDedicatedServer());
+	IOnlineSubsystem* const OnlineSub = IOnlineSubsystem::Get();
+
+	if (OnlineSub)
+	{
+		IOnlineSessionPtr Sessions = OnlineSub->GetSessionInterface();
+
+		if (Sessions.IsValid())
+		{
+			SessionSettings = MakeShared<FOnlineSessionSettings>();
+
+			SessionSettings->NumPublicConnections  = MaxNumPlayers;
+			SessionSettings->NumPrivateConnections = 0;
+			SessionSettings->bIsLANMatch           = false;
+			SessionSettings->bIsDedicated          = true;
+			SessionSettings->bUsesPresence         = false;
+			SessionSettings->bAllowInvites         = false;
+			SessionSettings->bAllowJoinInProgress  = true;
+			SessionSettings->bShouldAdvertise      = true;
+			SessionSettings->bAllowJoinViaPresence = false;
+
+			NextURL = URL;
+			SessionSettings->Set(SETTING_MAPNAME, URL, EOnlineDataAdvertisementType::ViaOnlineService);
+
+			NetworkState = ENovaNetworkState::Starting;
+
+			// Start, with no hosting player
+			OnCreateSessionCompleteDelegateHandle = Sessions->AddOnCreateSessionCompleteDelegate_Handle(OnCreateSessionCompleteDelegate);
+			return Sessions->CreateSession(0, NAME_GameSession, *SessionSettings);
+		}
+	}
+
+	return false;
+}
+
 bool UNovaSessionsManager::EndSession(FString URL)
 {
 	NLOG("UNovaSessionsManager::EndSession");
@@ -418,7 +457,14 @@ void UNovaSessionsManager::OnStartOnlineGameComplete(FName SessionName, bool bWa
 	{
 		NetworkState = ENovaNetworkState::OnlineHost;
 
-		GameInstance->GetFirstLocalPlayerController()->ClientTravel(NextURL + TEXT("?listen"), ETravelType::TRAVEL_Absolute, false);
+		if (IsRunningDedicatedServer())
+		{
+			GameInstance->ServerTravel(NextURL);
+		}
+		else
+		{
+			GameInstance->GetFirstLocalPlayerController()->ClientTravel(NextURL + TEXT("?listen"), ETravelType::TRAVEL_Absolute, false);
+		}
 
 		NextURL = FString();
 	}
@@ -657,6 +703,17 @@ void UNovaSessionsManager::OnSessionError(ENovaNetworkError Type)
 	LastNetworkError       = Type;
 	LastNetworkErrorString = "";
 
+	// Dedicated servers have no menu to fall back to, serve the level without a session so that it stays reachable by address
+	if (IsRunningDedicatedServer())
+	{
+		if (NextURL.Len())
+		{
+			GameInstance->ServerTravel(NextURL);
+			NextURL = FString();
+		}
+		return;
+	}
+
 	ProcessAction(ActionAfterError);
 }
 
@@ -119,6 +119,9 @@ public:
 	/** Start a multiplayer session and open URL as a listen server */
 	bool StartSession(FString URL, int32 MaxNumPlayers, bool Public = true);
 
+	/** Start a multiplayer session without a local player and open URL, on dedicated servers */
+	bool StartDedicatedSession(FString URL, int32 MaxNumPlayers);
+
 	/** Finish the online session and open URL as standalone */
 	bool EndSession(FString URL);
 
@@ -21,6 +21,8 @@ void SNovaLoadingScreen::Construct(const FArguments& InArgs)
 	uint32_t Width  = InArgs._Settings->Width;
 	uint32_t Height = InArgs._Settings->Height;
 
+	const FNovaMainTheme& Theme = FNovaStyleSet::GetMainTheme();
+
 	// Build the top loading brush
 	LoadingScreenAnimatedBrush = FDeferredCleanupSlateBrush::CreateBrush(AnimatedMaterialInstance, FVector2D(Width, Height));
 	NCHECK(LoadingScreenAnimatedBrush.IsValid());
@@ -60,6 +62,19 @@ void SNovaLoadingScreen::Construct(const FArguments& InArgs)
 					.BorderBackgroundColor(this, &SNovaLoadingScreen::GetColor)
 				]
 			]
+
+			// Load progress
+			+ SOverlay::Slot()
+			.VAlign(VAlign_Bottom)
+			.HAlign(HAlign_Fill)
+			.Padding(Theme.ContentPadding)
+			[
+				SNew(SProgressBar)
+				.Style(&Theme.ProgressBarStyle)
+				.Percent(this, &SNovaLoadingScreen::GetProgress)
+				.FillColorAndOpacity(this, &SNovaLoadingScreen::GetColor)
+				.Visibility(this, &SNovaLoadingScreen::GetProgressVisibility)
+			]
 		]
 	];
 	// clang-format on
@@ -74,6 +89,11 @@ void SNovaLoadingScreen::SetFadeAlpha(float Alpha)
 	CurrentAlpha = Alpha;
 }
 
+void SNovaLoadingScreen::SetProgress(TOptional<float> Progress)
+{
+	CurrentProgress = Progress;
+}
+
 FSlateColor SNovaLoadingScreen::GetColor() const
 {
 	return FLinearColor(1, 1, 1, CurrentAlpha);
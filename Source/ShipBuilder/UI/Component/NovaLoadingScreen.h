@@ -47,6 +47,9 @@ public:
 		return CurrentAlpha;
 	}
 
+	/** Set the progress of the current load, if any */
+	void SetProgress(TOptional<float> Progress);
+
 	/** Get the current fade alpha */
 	FSlateColor GetColor() const;
 
@@ -58,6 +61,21 @@ public:
 
 	virtual void Tick(const FGeometry& AllottedGeometry, const double CurrentTime, const float DeltaTime) override;
 
+protected:
+	/*----------------------------------------------------
+	    Callbacks
+	----------------------------------------------------*/
+
+	TOptional<float> GetProgress() const
+	{
+		return CurrentProgress;
+	}
+
+	EVisibility GetProgressVisibility() const
+	{
+		return CurrentProgress.IsSet() ? EVisibility::HitTestInvisible : EVisibility::Hidden;
+	}
+
 protected:
 	/*----------------------------------------------------
 	    Private data
@@ -68,4 +86,5 @@ protected:
 	class UMaterialInstanceDynamic*        AnimatedMaterialInstance;
 	float                                  LoadingScreenTime;
 	float                                  CurrentAlpha;
+	TOptional<float>                       CurrentProgress;
 };
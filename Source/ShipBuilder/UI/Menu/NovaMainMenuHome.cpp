@@ -5,9 +5,13 @@
 #include "NovaMainMenu.h"
 
 #include "Player/NovaPlayerController.h"
+#include "Game/NovaArea.h"
+#include "System/NovaGameInstance.h"
 #include "System/NovaMenuManager.h"
+#include "System/NovaSaveManager.h"
 
 #include "UI/Component/NovaLargeButton.h"
+#include "UI/Widget/NovaFadingWidget.h"
 
 #include "Nova.h"
 
@@ -69,8 +73,8 @@ void SNovaMainMenuHome::Construct(const FArguments& InArgs)
 						SNovaDefaultNew(SNovaLargeButton)
 						.Theme("MainMenuButton")
 						.Icon(FNovaStyleSet::GetBrush("Icon/SB_Menu"))
-						.Text(LOCTEXT("Launch1", "Slot 1"))
-						.HelpText(LOCTEXT("LaunchHelp1", "Load save data from the first save slot"))
+						.Text(FNovaTextGetter::CreateSP(this, &SNovaMainMenuHome::GetSlotText, 1))
+						.HelpText(FNovaTextGetter::CreateSP(this, &SNovaMainMenuHome::GetSlotHelpText, 1))
 						.OnClicked(FSimpleDelegate::CreateLambda([this]() { OnLaunchGame(1); } ))
 					]
 
@@ -79,8 +83,8 @@ void SNovaMainMenuHome::Construct(const FArguments& InArgs)
 						SNovaDefaultNew(SNovaLargeButton)
 						.Theme("MainMenuButton")
 						.Icon(FNovaStyleSet::GetBrush("Icon/SB_Menu"))
-						.Text(LOCTEXT("Launch2", "Slot 2"))
-						.HelpText(LOCTEXT("LaunchHelp2", "Load save data from the second save slot"))
+						.Text(FNovaTextGetter::CreateSP(this, &SNovaMainMenuHome::GetSlotText, 2))
+						.HelpText(FNovaTextGetter::CreateSP(this, &SNovaMainMenuHome::GetSlotHelpText, 2))
 						.OnClicked(FSimpleDelegate::CreateLambda([this]() { OnLaunchGame(2); } ))
 					]
 
@@ -89,8 +93,8 @@ void SNovaMainMenuHome::Construct(const FArguments& InArgs)
 						SNovaDefaultNew(SNovaLargeButton)
 						.Theme("MainMenuButton")
 						.Icon(FNovaStyleSet::GetBrush("Icon/SB_Menu"))
-						.Text(LOCTEXT("Launch3", "Slot 3"))
-						.HelpText(LOCTEXT("LaunchHelp3", "Load save data from the third save slot"))
+						.Text(FNovaTextGetter::CreateSP(this, &SNovaMainMenuHome::GetSlotText, 3))
+						.HelpText(FNovaTextGetter::CreateSP(this, &SNovaMainMenuHome::GetSlotHelpText, 3))
 						.OnClicked(FSimpleDelegate::CreateLambda([this]() { OnLaunchGame(3); } ))
 					]
 
@@ -109,6 +113,16 @@ void SNovaMainMenuHome::Construct(const FArguments& InArgs)
 void SNovaMainMenuHome::Show()
 {
 	SNovaTabPanel::Show();
+
+	// Read the slot summaries only, without loading saves
+	UNovaSaveManager* SaveManager = MenuManager->GetGameInstance()->GetSaveManager();
+	SlotMetadata.Empty();
+	SlotExists.Empty();
+	for (int32 Index = 1; Index <= 3; Index++)
+	{
+		SlotMetadata.Add(SaveManager->GetSaveMetadata(FString::FromInt(Index)));
+		SlotExists.Add(SaveManager->DoesSaveExist(FString::FromInt(Index)));
+	}
 }
 
 void SNovaMainMenuHome::Hide()
@@ -120,6 +134,44 @@ void SNovaMainMenuHome::Hide()
     Content callbacks
 ----------------------------------------------------*/
 
+FText SNovaMainMenuHome::GetSlotText(int32 Index) const
+{
+	const FNovaSaveMetadata* Metadata = SlotMetadata.IsValidIndex(Index - 1) ? &SlotMetadata[Index - 1] : nullptr;
+
+	if (Metadata && Metadata->IsValid() && Metadata->SpacecraftName.Len())
+	{
+		return FText::FormatNamed(LOCTEXT("SlotSpacecraft", "Slot {index} - {spacecraft}"), TEXT("index"), FText::AsNumber(Index),
+			TEXT("spacecraft"), FText::FromString(Metadata->SpacecraftName));
+	}
+	else
+	{
+		return FText::FormatNamed(LOCTEXT("Slot", "Slot {index}"), TEXT("index"), FText::AsNumber(Index));
+	}
+}
+
+FText SNovaMainMenuHome::GetSlotHelpText(int32 Index) const
+{
+	const FNovaSaveMetadata* Metadata = SlotMetadata.IsValidIndex(Index - 1) ? &SlotMetadata[Index - 1] : nullptr;
+
+	if (Metadata && Metadata->IsValid())
+	{
+		FText AreaText = IsValid(Metadata->CurrentArea) ? Metadata->CurrentArea->Name : LOCTEXT("UnknownArea", "deep space");
+
+		return FText::FormatNamed(LOCTEXT("SlotHelp", "Continue at {area} on {date} with {credits} - saved {timestamp}"),
+			TEXT("area"), AreaText, TEXT("date"), ::GetDateText(Metadata->GameTime), TEXT("credits"),
+			GetPriceText(Metadata->Credits), TEXT("timestamp"), FText::AsDateTime(Metadata->Timestamp));
+	}
+	else if (SlotExists.IsValidIndex(Index - 1) && SlotExists[Index - 1])
+	{
+		return FText::FormatNamed(
+			LOCTEXT("SlotHelpUnknown", "Load save data from save slot {index}"), TEXT("index"), FText::AsNumber(Index));
+	}
+	else
+	{
+		return FText::FormatNamed(LOCTEXT("SlotHelpEmpty", "Start a new game in save slot {index}"), TEXT("index"), FText::AsNumber(Index));
+	}
+}
+
 /*----------------------------------------------------
     Callbacks
 ----------------------------------------------------*/
@@ -39,6 +39,11 @@ public:
 	    Content callbacks
 	----------------------------------------------------*/
 
+protected:
+	FText GetSlotText(int32 Index) const;
+
+	FText GetSlotHelpText(int32 Index) const;
+
 protected:
 	/*----------------------------------------------------
 	    Callbacks
@@ -53,4 +58,8 @@ protected:
 protected:
 	// Menu manager
 	TWeakObjectPtr<UNovaMenuManager> MenuManager;
+
+	// Save slots
+	TArray<struct FNovaSaveMetadata> SlotMetadata;
+	TArray<bool>                     SlotExists;
 };
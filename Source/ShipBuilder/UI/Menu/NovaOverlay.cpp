@@ -6,6 +6,7 @@
 #include "UI/Component/NovaNotification.h"
 #include "UI/Widget/NovaFadingWidget.h"
 
+#include "Game/NovaGameState.h"
 #include "System/NovaMenuManager.h"
 #include "Nova.h"
 
@@ -37,6 +38,13 @@ void SNovaOverlay::Construct(const FArguments& InArgs)
 		[
 			SAssignNew(FastForward, SBorder)
 			.BorderImage(FNovaStyleSet::GetBrush("Common/SB_Black"))
+			.VAlign(VAlign_Bottom)
+			.Padding(Theme.ContentPadding)
+			[
+				SNew(SProgressBar)
+				.Style(&Theme.ProgressBarStyle)
+				.Percent(this, &SNovaOverlay::GetFastForwardProgress)
+			]
 		]
 
 		+ SOverlay::Slot()
@@ -67,4 +75,15 @@ void SNovaOverlay::StopFastForward()
 	FastForward->SetVisibility(EVisibility::Collapsed);
 }
 
+/*----------------------------------------------------
+    Callbacks
+----------------------------------------------------*/
+
+TOptional<float> SNovaOverlay::GetFastForwardProgress() const
+{
+	const ANovaGameState* GameState = MenuManager.IsValid() ? MenuManager->GetWorld()->GetGameState<ANovaGameState>() : nullptr;
+
+	return IsValid(GameState) ? GameState->GetFastForwardProgress() : 0.0f;
+}
+
 #undef LOCTEXT_NAMESPACE
@@ -36,6 +36,14 @@ public:
 	/** Start the fast-forward overlay */
 	void StopFastForward();
 
+	/*----------------------------------------------------
+	    Callbacks
+	----------------------------------------------------*/
+
+protected:
+	/** Get the fast-forward progress */
+	TOptional<float> GetFastForwardProgress() const;
+
 	/*----------------------------------------------------
 	    Data
 	----------------------------------------------------*/